@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cartesian_flight_recorder/flight_record.h>
+#include <cartesian_interface/cartesian_command_interface.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A stand-in for a hardware_interface::RobotHW that plays back recorded states
+ *
+ * Holds the buffers of a single Cartesian frame and registers them with a
+ * CartesianStateInterface and a TwistCommandInterface, so that controllers
+ * obtain their handles just like on a robot. read() copies one recorded
+ * cycle's state into the buffers.
+ */
+class ReplayHardware
+{
+public:
+  ReplayHardware(const std::string& ref_frame_id, const std::string& frame_id);
+  ReplayHardware(const ReplayHardware&) = delete;
+  ReplayHardware& operator=(const ReplayHardware&) = delete;
+
+  /**
+   * @brief Provide the state of \a record to the handles
+   */
+  void read(const FlightRecord& record);
+
+  /**
+   * @brief The twist that a controller wrote through the TwistCommandInterface
+   */
+  const geometry_msgs::Twist& getTwistCommand() const
+  {
+    return twist_command_;
+  }
+
+  CartesianStateInterface state_interface;
+  TwistCommandInterface twist_command_interface;
+
+private:
+  geometry_msgs::Pose pose_;
+  geometry_msgs::Twist twist_;
+  geometry_msgs::Accel accel_;
+  geometry_msgs::Accel jerk_;
+  geometry_msgs::Twist twist_command_;
+};
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include <cartesian_flight_recorder/flight_record.h>
+#include <twist_controller/twist_limiter.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief How to configure the replayed TwistController and compare its output
+ */
+struct TwistReplaySettings
+{
+  TwistReplaySettings()
+    : gain(Vector6d::Constant(0.1))
+  {
+  }
+
+  TwistLimits limits;                ///< The \a max_velocity, \a max_acceleration and \a max_jerk parameters
+  Vector6d gain;                     ///< The \a gain parameter per axis
+  double command_timeout = { 0.5 };  ///< The \a command_timeout parameter. Zero disables it.
+  double tolerance = { 1e-9 };       ///< Largest deviation per axis that still counts as a match
+  size_t warmup = { 0 };             ///< Cycles at the start that are replayed but not compared
+};
+
+/**
+ * @brief How closely a replay reproduced the recorded twist commands
+ */
+struct TwistReplayResult
+{
+  TwistReplayResult()
+    : max_error(Vector6d::Zero())
+  {
+  }
+
+  size_t cycles = { 0 };            ///< Replayed cycles
+  size_t compared = { 0 };          ///< Cycles with a recorded twist command after the warmup
+  size_t mismatches = { 0 };        ///< Compared cycles that exceed the tolerance on any axis
+  uint64_t first_mismatch = { 0 };  ///< Recorded cycle of the first mismatch, zero if none
+  Vector6d max_error;               ///< Largest absolute deviation per axis
+};
+
+/**
+ * @brief Run a TwistController offline on recorded states and inputs
+ *
+ * The controller runs against a ReplayHardware, without a ROS node or
+ * master and as fast as possible. Each record provides the state for one
+ * update(), whose time and period are taken from the recorded stamps.
+ * Whenever the recorded input changes, it is passed to the controller
+ * through setCommand(), so queued and shared memory inputs replay like
+ * plain commands.
+ *
+ * The limiter's state is not on file. Recordings that don't start with
+ * the controller, i.e. whose first cycle isn't one, therefore need a few
+ * \a warmup cycles until the replay catches up.
+ *
+ * @param records Recorded cycles in chronological order, e.g. from FlightRecorder::load()
+ * @param settings The controller's configuration to test
+ * @param outputs If given, receives the replayed twist command of each cycle
+ */
+TwistReplayResult replayTwistController(const std::vector<FlightRecord>& records,
+                                        const TwistReplaySettings& settings,
+                                        std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>>* outputs = nullptr);
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_controller_replay/replay_hardware.h>
+
+namespace cartesian_ros_control
+{
+ReplayHardware::ReplayHardware(const std::string& ref_frame_id, const std::string& frame_id)
+{
+  pose_.orientation.w = 1.0;
+  CartesianStateHandle state_handle(ref_frame_id, frame_id, &pose_, &twist_, &accel_, &jerk_);
+  state_interface.registerHandle(state_handle);
+  twist_command_interface.registerHandle(TwistCommandHandle(state_handle, &twist_command_));
+}
+
+void ReplayHardware::read(const FlightRecord& record)
+{
+  pose_.position.x = record.pose[0];
+  pose_.position.y = record.pose[1];
+  pose_.position.z = record.pose[2];
+  pose_.orientation.x = record.pose[3];
+  pose_.orientation.y = record.pose[4];
+  pose_.orientation.z = record.pose[5];
+  pose_.orientation.w = record.pose[6];
+
+  twist_.linear.x = record.twist[0];
+  twist_.linear.y = record.twist[1];
+  twist_.linear.z = record.twist[2];
+  twist_.angular.x = record.twist[3];
+  twist_.angular.y = record.twist[4];
+  twist_.angular.z = record.twist[5];
+
+  accel_.linear.x = record.accel[0];
+  accel_.linear.y = record.accel[1];
+  accel_.linear.z = record.accel[2];
+  accel_.angular.x = record.accel[3];
+  accel_.angular.y = record.accel[4];
+  accel_.angular.z = record.accel[5];
+}
+}  // namespace cartesian_ros_control
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_controller_replay/twist_controller_replay.h>
+
+#include <cstring>
+
+#include <cartesian_controller_replay/replay_hardware.h>
+#include <twist_controller/twist_controller.h>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+bool sameInput(const FlightRecord& a, const FlightRecord& b)
+{
+  const uint32_t mask = FlightRecord::TWIST_INPUT | FlightRecord::INPUT_IN_TOOL_FRAME;
+  return (a.flags & mask) == (b.flags & mask) && a.input_stamp == b.input_stamp &&
+         std::memcmp(a.input_twist, b.input_twist, sizeof(a.input_twist)) == 0 &&
+         std::memcmp(a.input_rotation, b.input_rotation, sizeof(a.input_rotation)) == 0;
+}
+}  // namespace
+
+TwistReplayResult replayTwistController(const std::vector<FlightRecord>& records,
+                                        const TwistReplaySettings& settings,
+                                        std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>>* outputs)
+{
+  TwistReplayResult result;
+  if (outputs)
+  {
+    outputs->clear();
+    outputs->reserve(records.size());
+  }
+  if (records.empty())
+  {
+    return result;
+  }
+
+  // Frame names are not on file. The controller only needs the orientation.
+  ReplayHardware hw("base", "tool0");
+  TwistController controller;
+  controller.handle_ = hw.twist_command_interface.getHandle("tool0");
+  controller.setLimits(settings.limits);
+  controller.setCommandTimeout(ros::Duration(settings.command_timeout));
+  TwistController::TwistGain gain;
+  gain.values = settings.gain;
+  controller.gain_buffer_.initRT(gain);
+
+  ros::Time time;
+  time.fromNSec(records.front().stamp);
+  controller.starting(time);
+
+  const FlightRecord* last_input = nullptr;
+  for (size_t i = 0; i < records.size(); ++i)
+  {
+    const FlightRecord& record = records[i];
+    const ros::Time last_time = time;
+    time.fromNSec(record.stamp);
+
+    // The first cycle's period is unknown. The next one is the best guess.
+    ros::Duration period = time - last_time;
+    if (i == 0 && records.size() > 1)
+    {
+      period.fromNSec(records[1].stamp - record.stamp);
+    }
+
+    if ((record.flags & FlightRecord::TWIST_INPUT) && (!last_input || !sameInput(record, *last_input)))
+    {
+      TwistController::TwistCommand command;
+      command.twist = Eigen::Map<const Vector6d>(record.input_twist);
+      command.rotation = Eigen::Quaterniond(record.input_rotation[3], record.input_rotation[0],
+                                            record.input_rotation[1], record.input_rotation[2])
+                             .toRotationMatrix();
+      command.in_tool_frame = record.flags & FlightRecord::INPUT_IN_TOOL_FRAME;
+      command.stamp.fromNSec(record.input_stamp);
+      command.received = time;
+      controller.setCommand(command);
+      last_input = &record;
+    }
+
+    hw.read(record);
+    controller.update(time, period);
+    ++result.cycles;
+
+    const geometry_msgs::Twist& output = hw.getTwistCommand();
+    Vector6d twist;
+    twist << output.linear.x, output.linear.y, output.linear.z, output.angular.x, output.angular.y, output.angular.z;
+    if (outputs)
+    {
+      outputs->push_back(twist);
+    }
+
+    if (i < settings.warmup || !(record.flags & FlightRecord::TWIST_COMMAND))
+    {
+      continue;
+    }
+    ++result.compared;
+    const Vector6d error = (twist - Eigen::Map<const Vector6d>(record.twist_command)).cwiseAbs();
+    result.max_error = result.max_error.cwiseMax(error);
+    if ((error.array() > settings.tolerance).any())
+    {
+      if (result.mismatches == 0)
+      {
+        result.first_mismatch = record.cycle;
+      }
+      ++result.mismatches;
+    }
+  }
+  return result;
+}
+}  // namespace cartesian_ros_control
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cartesian_controller_replay/twist_controller_replay.h>
+#include <cartesian_flight_recorder/flight_recorder.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+const char* USAGE =
+    "Usage: twist_controller_replay RECORDING [OPTIONS]\n"
+    "\n"
+    "Replays a flight recorder file through a TwistController and compares its\n"
+    "twist commands with the recorded ones. Exits with 0 if all of them match,\n"
+    "with 1 if some don't and with 2 on errors.\n"
+    "\n"
+    "Options mirror the controller's parameters. Six values are separated by commas.\n"
+    "  --gain G|G1,...,G6\n"
+    "  --max_velocity V1,...,V6\n"
+    "  --max_acceleration A1,...,A6\n"
+    "  --max_jerk J1,...,J6\n"
+    "  --command_timeout SECONDS\n"
+    "  --tolerance VALUE     Largest deviation per axis that still matches\n"
+    "  --warmup CYCLES       Cycles at the start that are not compared\n";
+
+bool parseValues(const std::string& text, std::vector<double>& values)
+{
+  values.clear();
+  std::stringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    char* end = nullptr;
+    values.push_back(std::strtod(item.c_str(), &end));
+    if (item.empty() || *end != '\0')
+    {
+      return false;
+    }
+  }
+  return !values.empty();
+}
+
+bool parseVector(const std::string& text, bool allow_scalar, Vector6d& vector)
+{
+  std::vector<double> values;
+  if (!parseValues(text, values))
+  {
+    return false;
+  }
+  if (allow_scalar && values.size() == 1)
+  {
+    vector.setConstant(values[0]);
+    return true;
+  }
+  if (values.size() != 6)
+  {
+    return false;
+  }
+  vector = Eigen::Map<const Vector6d>(values.data());
+  return true;
+}
+
+bool parseScalar(const std::string& text, double& value)
+{
+  std::vector<double> values;
+  if (!parseValues(text, values) || values.size() != 1 || values[0] < 0.0)
+  {
+    return false;
+  }
+  value = values[0];
+  return true;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (argc < 2 || std::string(argv[1]) == "--help")
+  {
+    std::cerr << USAGE;
+    return 2;
+  }
+
+  TwistReplaySettings settings;
+  for (int i = 2; i < argc; i += 2)
+  {
+    const std::string option = argv[i];
+    if (i + 1 >= argc)
+    {
+      std::cerr << "Missing value for " << option << "\n" << USAGE;
+      return 2;
+    }
+    const std::string value = argv[i + 1];
+
+    bool valid = false;
+    double scalar = 0.0;
+    if (option == "--gain")
+    {
+      valid = parseVector(value, true, settings.gain);
+    }
+    else if (option == "--max_velocity")
+    {
+      valid = parseVector(value, false, settings.limits.velocity);
+    }
+    else if (option == "--max_acceleration")
+    {
+      valid = parseVector(value, false, settings.limits.acceleration);
+    }
+    else if (option == "--max_jerk")
+    {
+      valid = parseVector(value, false, settings.limits.jerk);
+    }
+    else if (option == "--command_timeout")
+    {
+      valid = parseScalar(value, settings.command_timeout);
+    }
+    else if (option == "--tolerance")
+    {
+      valid = parseScalar(value, settings.tolerance);
+    }
+    else if (option == "--warmup")
+    {
+      valid = parseScalar(value, scalar);
+      settings.warmup = static_cast<size_t>(scalar);
+    }
+    else
+    {
+      std::cerr << "Unknown option " << option << "\n" << USAGE;
+      return 2;
+    }
+
+    if (!valid)
+    {
+      std::cerr << "Invalid value '" << value << "' for " << option << "\n";
+      return 2;
+    }
+  }
+
+  std::vector<FlightRecord> records;
+  FlightRecordFileHeader header;
+  std::string error;
+  if (!FlightRecorder::load(argv[1], records, header, error))
+  {
+    std::cerr << error << "\n";
+    return 2;
+  }
+  if (!records.empty() && records.front().cycle != 1 && settings.warmup == 0)
+  {
+    std::cerr << "Warning: The recording starts in cycle " << records.front().cycle
+              << " and not with the controller. Consider a --warmup.\n";
+  }
+
+  const TwistReplayResult result = replayTwistController(records, settings);
+  std::cout << "cycles: " << result.cycles << "\n"
+            << "compared: " << result.compared << "\n"
+            << "mismatches: " << result.mismatches << "\n"
+            << "first_mismatch: " << result.first_mismatch << "\n"
+            << "max_error: " << result.max_error.transpose() << "\n";
+  return result.mismatches == 0 ? 0 : 1;
+}
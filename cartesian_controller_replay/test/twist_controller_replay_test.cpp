@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+
+#include <unistd.h>
+
+#include <cartesian_controller_replay/replay_hardware.h>
+#include <cartesian_controller_replay/twist_controller_replay.h>
+#include <twist_controller/twist_controller.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+const size_t CYCLES = 1000;
+
+void configure(TwistController& controller, const TwistReplaySettings& settings)
+{
+  controller.setLimits(settings.limits);
+  controller.setCommandTimeout(ros::Duration(settings.command_timeout));
+  TwistController::TwistGain gain;
+  gain.values = settings.gain;
+  controller.gain_buffer_.initRT(gain);
+}
+
+TwistReplaySettings limitedSettings()
+{
+  TwistReplaySettings settings;
+  settings.limits.velocity.setConstant(0.5);
+  settings.limits.acceleration.setConstant(2.0);
+  settings.limits.jerk.setConstant(50.0);
+  return settings;
+}
+
+/**
+ * @brief Run a controller at 1 kHz with its flight recorder on and load the file
+ *
+ * The robot turns about z. A tool frame command is followed by one in a
+ * rotated frame, after which the source goes silent and times out.
+ */
+std::vector<FlightRecord> recordRun(const TwistReplaySettings& settings)
+{
+  const std::string path = "/tmp/cartesian_controller_replay_" + std::to_string(getpid()) + ".bin";
+  {
+    ReplayHardware hw("base", "tool0");
+    TwistController controller;
+    controller.handle_ = hw.twist_command_interface.getHandle("tool0");
+    configure(controller, settings);
+
+    FlightRecorderSettings recorder;
+    recorder.path = path;
+    recorder.records = CYCLES;
+    std::string error;
+    EXPECT_TRUE(controller.openFlightRecorder(recorder, error)) << error;
+
+    const ros::Time start(100.0);
+    const ros::Duration period(0.001);
+    controller.starting(start);
+
+    for (size_t i = 0; i < CYCLES; ++i)
+    {
+      const ros::Time time = start + ros::Duration(0.001 * (i + 1));
+      if (i == 10 || i == 200)
+      {
+        TwistController::TwistCommand input;
+        input.stamp = time;
+        input.received = time;
+        if (i == 10)
+        {
+          input.twist << 1.0, 0.0, 0.0, 0.0, 0.0, 0.5;
+          input.in_tool_frame = true;
+        }
+        else
+        {
+          input.twist << 0.0, 2.0, 0.5, 0.0, 0.0, 0.0;
+          input.rotation = Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+        }
+        controller.setCommand(input);
+      }
+
+      FlightRecord state = {};
+      state.pose[5] = std::sin(0.0005 * i);
+      state.pose[6] = std::cos(0.0005 * i);
+      hw.read(state);
+      controller.update(time, period);
+    }
+  }  // Closing the recorder writes the file
+
+  std::vector<FlightRecord> records;
+  FlightRecordFileHeader header;
+  std::string error;
+  EXPECT_TRUE(FlightRecorder::load(path, records, header, error)) << error;
+  EXPECT_EQ(0u, header.dropped);
+  std::remove(path.c_str());
+  return records;
+}
+}  // namespace
+
+TEST(TwistControllerReplayTest, TestReplayReproducesRecording)
+{
+  const TwistReplaySettings settings = limitedSettings();
+  const std::vector<FlightRecord> records = recordRun(settings);
+  ASSERT_EQ(CYCLES, records.size());
+
+  std::vector<Vector6d, Eigen::aligned_allocator<Vector6d>> outputs;
+  const TwistReplayResult result = replayTwistController(records, settings, &outputs);
+  EXPECT_EQ(CYCLES, result.cycles);
+  EXPECT_EQ(CYCLES, result.compared);
+  EXPECT_EQ(0u, result.mismatches);
+  EXPECT_EQ(0u, result.first_mismatch);
+  EXPECT_LT(result.max_error.maxCoeff(), 1e-12);
+  ASSERT_EQ(CYCLES, outputs.size());
+
+  // The run moved and came to a stop after the timeout
+  EXPECT_GT(std::abs(records[600].twist_command[0]), 0.1);
+  EXPECT_LT(outputs.back().norm(), 1e-6);
+}
+
+TEST(TwistControllerReplayTest, TestReplayDetectsChanges)
+{
+  const std::vector<FlightRecord> records = recordRun(limitedSettings());
+
+  TwistReplaySettings settings = limitedSettings();
+  settings.gain[2] = 0.2;
+  TwistReplayResult result = replayTwistController(records, settings);
+  EXPECT_GT(result.mismatches, 0u);
+  EXPECT_GT(result.first_mismatch, 200u);
+  EXPECT_GT(result.max_error[2], 1e-3);
+  EXPECT_LT(result.max_error[0], 1e-12);
+
+  // Shorter timeouts stop during the gap between both commands
+  settings = limitedSettings();
+  settings.command_timeout = 0.1;
+  result = replayTwistController(records, settings);
+  EXPECT_GT(result.mismatches, 0u);
+  EXPECT_GT(result.first_mismatch, 110u);
+  EXPECT_LT(result.first_mismatch, 200u);
+
+  // Nothing is compared within the warmup
+  settings.warmup = CYCLES;
+  result = replayTwistController(records, settings);
+  EXPECT_EQ(CYCLES, result.cycles);
+  EXPECT_EQ(0u, result.compared);
+  EXPECT_EQ(0u, result.mismatches);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief One control cycle in a flight recorder file
+ *
+ * A fixed layout of plain values, so that files can be read without ROS,
+ * e.g. with numpy. Poses are position x, y, z followed by the orientation
+ * quaternion x, y, z, w. Twists and accelerations are linear x, y, z
+ * followed by angular x, y, z. Commands and inputs are only valid if the
+ * according bit in \a flags is set.
+ *
+ * Commands are what the controller sent to the hardware. The input is the
+ * target that the controller acted on in that cycle, so that its behavior
+ * can be replayed offline.
+ */
+struct FlightRecord
+{
+  enum Flags : uint32_t
+  {
+    TWIST_COMMAND = 1 << 0,
+    POSE_COMMAND = 1 << 1,
+    TWIST_INPUT = 1 << 2,
+    INPUT_IN_TOOL_FRAME = 1 << 3  ///< The input twist is given in the controlled frame
+  };
+
+  uint64_t cycle;  ///< Counts from one with every recorded cycle
+  int64_t stamp;   ///< Time of the cycle in nanoseconds
+  double pose[7];
+  double twist[6];
+  double accel[6];
+  double twist_command[6];
+  double pose_command[7];
+  double input_twist[6];     ///< In the frame the input was given in
+  double input_rotation[4];  ///< Quaternion from the input's frame to the reference frame
+  int64_t input_stamp;       ///< Creation time of the input in nanoseconds
+  uint32_t flags;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(FlightRecord) == 368, "The flight record layout must not change without a new version");
+
+/**
+ * @brief A twist input as a controller received it
+ */
+struct FlightRecordInput
+{
+  const double* twist;     ///< Linear x, y, z followed by angular x, y, z
+  const double* rotation;  ///< Quaternion x, y, z, w. Ignored if \a in_tool_frame is set.
+  int64_t stamp;
+  bool in_tool_frame;
+};
+
+/**
+ * @brief The header of a flight recorder file
+ *
+ * The file holds \a capacity records after this header, written round
+ * robin. Once more than \a capacity records are written, the oldest one is
+ * at index \a written % \a capacity.
+ */
+struct FlightRecordFileHeader
+{
+  static constexpr uint32_t MAGIC = 0x52464352;  // "RCFR"
+  static constexpr uint32_t VERSION = 2;
+
+  uint32_t magic;
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t reserved;
+  uint64_t capacity;
+  uint64_t written;  ///< Records written in total
+  uint64_t trigger;  ///< Cycle in which the recorder was triggered, zero if never
+  uint64_t dropped;  ///< Records lost because the background thread fell behind
+};
+
+static_assert(sizeof(FlightRecordFileHeader) == 48, "The flight record file header must not change");
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geometry_msgs/Pose.h>
+#include <geometry_msgs/Twist.h>
+#include <ros/time.h>
+
+#include <cartesian_flight_recorder/flight_record.h>
+#include <cartesian_interface/cartesian_command_interface.h>
+#include <cartesian_interface/spsc_queue.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Settings of a FlightRecorder
+ */
+struct FlightRecorderSettings
+{
+  enum Mode
+  {
+    CONTINUOUS,  ///< Keep the latest records on disk at all times
+    TRIGGERED    ///< Freeze the file shortly after trigger() for post-mortem analysis
+  };
+
+  std::string path;                       ///< The file to record into
+  Mode mode = { CONTINUOUS };             ///< What happens on trigger()
+  size_t records = { 60000 };             ///< Capacity of the file in records
+  size_t queue_size = { 4096 };           ///< Records buffered between record() and the file
+  size_t post_trigger_records = { 500 };  ///< Records after trigger() before a triggered file freezes
+  double flush_period = { 1.0 };          ///< Seconds between flushes to disk in continuous mode
+};
+
+/**
+ * @brief Records which state and commands each control cycle saw
+ *
+ * record() copies the state of a Cartesian handle and the last command
+ * into a preallocated wait-free queue. A background thread drains the
+ * queue into a memory-mapped file of FlightRecordFileHeader and
+ * FlightRecord entries, which are written round robin.
+ *
+ * In continuous mode, the file is flushed every \a flush_period seconds.
+ * In triggered mode, trigger() marks the current cycle. Once
+ * \a post_trigger_records more cycles are on file, the file is flushed
+ * and no longer overwritten, so that it holds the history around the
+ * incident. trigger() is also available in continuous mode to mark a
+ * cycle in the file's header.
+ *
+ * In either mode, the file is synced to disk as soon as the background
+ * thread notices the trigger.
+ *
+ * record() neither allocates nor blocks and is safe to call from one
+ * real-time thread. trigger() is wait-free and may be called from any
+ * thread. If the background thread falls behind, records are dropped and
+ * counted in the file's header.
+ */
+class FlightRecorder
+{
+public:
+  FlightRecorder() = default;
+  FlightRecorder(const FlightRecorder&) = delete;
+  FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+  ~FlightRecorder()
+  {
+    close();
+  }
+
+  /**
+   * @brief Create the file and start the background thread
+   *
+   * @return False with a human readable \a error if the file can't be created
+   */
+  bool open(const FlightRecorderSettings& settings, std::string& error);
+
+  /**
+   * @brief Write all pending records, flush the file and stop the background thread
+   */
+  void close();
+
+  bool isOpen() const
+  {
+    return file_ != nullptr;
+  }
+
+  /**
+   * @brief Record one cycle's state and commands
+   *
+   * @param time The cycle's time
+   * @param state The handle with the Cartesian state
+   * @param twist_command The twist sent in this cycle, if any
+   * @param pose_command The pose sent in this cycle, if any
+   * @param input The target the controller acted on, if any
+   */
+  void record(const ros::Time& time, const CartesianStateHandle& state,
+              const geometry_msgs::Twist* twist_command = nullptr, const geometry_msgs::Pose* pose_command = nullptr,
+              const FlightRecordInput* input = nullptr);
+
+  void record(const ros::Time& time, const TwistCommandHandle& handle, const FlightRecordInput* input = nullptr)
+  {
+    record(time, handle, &handle.getTwist(), nullptr, input);
+  }
+
+  void record(const ros::Time& time, const PoseCommandHandle& handle)
+  {
+    record(time, handle, nullptr, &handle.getPose());
+  }
+
+  /**
+   * @brief Mark the latest recorded cycle, e.g. on an error
+   *
+   * Only the first call after open() counts. Calls before the first
+   * record() are ignored.
+   */
+  void trigger();
+
+  /**
+   * @brief Read a flight recorder file in chronological order
+   *
+   * @return False with a human readable \a error if the file is unreadable or has an unknown layout
+   */
+  static bool load(const std::string& path, std::vector<FlightRecord>& records, FlightRecordFileHeader& header,
+                   std::string& error);
+
+private:
+  void drain();
+  void flush(bool sync);
+
+  FlightRecorderSettings settings_;
+  SpscQueue<FlightRecord> queue_;
+  FlightRecord rt_record_;
+  std::atomic<uint64_t> cycle_ = { 0 };  ///< Written by record() only
+  std::atomic<uint64_t> trigger_cycle_ = { 0 };
+  std::atomic<uint64_t> dropped_ = { 0 };
+
+  // Mapped in open(). Its contents are owned by the background thread while it runs.
+  char* file_ = { nullptr };
+  size_t file_size_ = { 0 };
+  std::thread thread_;
+  std::atomic<bool> running_ = { false };
+  bool frozen_ = { false };
+};
+
+}  // namespace cartesian_ros_control
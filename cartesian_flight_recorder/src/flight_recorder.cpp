@@ -0,0 +1,333 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_flight_recorder/flight_recorder.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+void toArray(const geometry_msgs::Pose& pose, double* values)
+{
+  values[0] = pose.position.x;
+  values[1] = pose.position.y;
+  values[2] = pose.position.z;
+  values[3] = pose.orientation.x;
+  values[4] = pose.orientation.y;
+  values[5] = pose.orientation.z;
+  values[6] = pose.orientation.w;
+}
+
+void toArray(const geometry_msgs::Vector3& linear, const geometry_msgs::Vector3& angular, double* values)
+{
+  values[0] = linear.x;
+  values[1] = linear.y;
+  values[2] = linear.z;
+  values[3] = angular.x;
+  values[4] = angular.y;
+  values[5] = angular.z;
+}
+
+FlightRecordFileHeader* headerOf(char* file)
+{
+  return reinterpret_cast<FlightRecordFileHeader*>(file);
+}
+
+FlightRecord* recordsOf(char* file)
+{
+  return reinterpret_cast<FlightRecord*>(file + sizeof(FlightRecordFileHeader));
+}
+}  // namespace
+
+bool FlightRecorder::open(const FlightRecorderSettings& settings, std::string& error)
+{
+  close();
+  if (settings.path.empty() || settings.records == 0 || settings.queue_size == 0)
+  {
+    error = "Flight recorder needs a path and a positive number of records and queue size.";
+    return false;
+  }
+
+  const int fd = ::open(settings.path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    error = "Cannot create flight recorder file '" + settings.path + "': " + std::strerror(errno);
+    return false;
+  }
+
+  // Reserve all blocks now, so that a full disk fails here instead of
+  // faulting later in the background thread.
+  const size_t size = sizeof(FlightRecordFileHeader) + settings.records * sizeof(FlightRecord);
+  const int result = posix_fallocate(fd, 0, size);
+  if (result != 0)
+  {
+    error = "Cannot allocate flight recorder file '" + settings.path + "': " + std::strerror(result);
+    ::close(fd);
+    return false;
+  }
+
+  void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (memory == MAP_FAILED)
+  {
+    error = "Cannot map flight recorder file '" + settings.path + "': " + std::strerror(errno);
+    return false;
+  }
+  file_ = static_cast<char*>(memory);
+  file_size_ = size;
+
+  FlightRecordFileHeader* header = headerOf(file_);
+  header->magic = FlightRecordFileHeader::MAGIC;
+  header->version = FlightRecordFileHeader::VERSION;
+  header->record_size = sizeof(FlightRecord);
+  header->reserved = 0;
+  header->capacity = settings.records;
+  header->written = 0;
+  header->trigger = 0;
+  header->dropped = 0;
+
+  settings_ = settings;
+  queue_.reset(settings.queue_size);
+  rt_record_ = FlightRecord();
+  cycle_.store(0, std::memory_order_relaxed);
+  trigger_cycle_.store(0, std::memory_order_relaxed);
+  dropped_.store(0, std::memory_order_relaxed);
+  frozen_ = false;
+
+  running_.store(true, std::memory_order_release);
+  thread_ = std::thread(&FlightRecorder::drain, this);
+  return true;
+}
+
+void FlightRecorder::close()
+{
+  if (!file_)
+  {
+    return;
+  }
+  running_.store(false, std::memory_order_release);
+  thread_.join();
+  flush(true);
+  munmap(file_, file_size_);
+  file_ = nullptr;
+  file_size_ = 0;
+}
+
+void FlightRecorder::record(const ros::Time& time, const CartesianStateHandle& state,
+                            const geometry_msgs::Twist* twist_command, const geometry_msgs::Pose* pose_command,
+                            const FlightRecordInput* input)
+{
+  if (!file_)
+  {
+    return;
+  }
+
+  const CartesianState current = state.getState();
+  const uint64_t cycle = cycle_.load(std::memory_order_relaxed) + 1;
+  rt_record_.cycle = cycle;
+  rt_record_.stamp = time.toNSec();
+  toArray(current.pose, rt_record_.pose);
+  toArray(current.twist.linear, current.twist.angular, rt_record_.twist);
+  toArray(current.accel.linear, current.accel.angular, rt_record_.accel);
+  rt_record_.flags = 0;
+  if (twist_command)
+  {
+    toArray(twist_command->linear, twist_command->angular, rt_record_.twist_command);
+    rt_record_.flags |= FlightRecord::TWIST_COMMAND;
+  }
+  if (pose_command)
+  {
+    toArray(*pose_command, rt_record_.pose_command);
+    rt_record_.flags |= FlightRecord::POSE_COMMAND;
+  }
+  if (input)
+  {
+    std::copy(input->twist, input->twist + 6, rt_record_.input_twist);
+    if (input->in_tool_frame)
+    {
+      std::fill(rt_record_.input_rotation, rt_record_.input_rotation + 3, 0.0);
+      rt_record_.input_rotation[3] = 1.0;
+      rt_record_.flags |= FlightRecord::INPUT_IN_TOOL_FRAME;
+    }
+    else
+    {
+      std::copy(input->rotation, input->rotation + 4, rt_record_.input_rotation);
+    }
+    rt_record_.input_stamp = input->stamp;
+    rt_record_.flags |= FlightRecord::TWIST_INPUT;
+  }
+
+  if (!queue_.push(rt_record_))
+  {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
+  cycle_.store(cycle, std::memory_order_relaxed);
+}
+
+void FlightRecorder::trigger()
+{
+  const uint64_t cycle = cycle_.load(std::memory_order_relaxed);
+  if (cycle == 0)
+  {
+    return;
+  }
+  uint64_t expected = 0;
+  trigger_cycle_.compare_exchange_strong(expected, cycle, std::memory_order_relaxed);
+}
+
+void FlightRecorder::drain()
+{
+  using std::chrono::steady_clock;
+
+  FlightRecordFileHeader* header = headerOf(file_);
+  FlightRecord* records = recordsOf(file_);
+  const auto flush_period = std::chrono::duration_cast<steady_clock::duration>(
+      std::chrono::duration<double>(settings_.flush_period));
+  steady_clock::time_point last_flush = steady_clock::now();
+  bool triggered = false;
+
+  for (;;)
+  {
+    // Check before draining, so that the last pass empties the queue
+    const bool running = running_.load(std::memory_order_acquire);
+
+    bool drained = false;
+    FlightRecord record;
+    while (queue_.pop(record))
+    {
+      drained = true;
+      if (frozen_)
+      {
+        continue;
+      }
+      records[header->written % header->capacity] = record;
+      ++header->written;
+      const uint64_t trigger = trigger_cycle_.load(std::memory_order_relaxed);
+      if (settings_.mode == FlightRecorderSettings::TRIGGERED && trigger != 0 &&
+          record.cycle >= trigger + settings_.post_trigger_records)
+      {
+        frozen_ = true;
+      }
+    }
+    const uint64_t trigger = trigger_cycle_.load(std::memory_order_relaxed);
+    header->trigger = trigger;
+    header->dropped = dropped_.load(std::memory_order_relaxed);
+
+    // Keep incidents on disk right away. Continuous recordings are
+    // additionally handed to the kernel periodically.
+    const bool incident = settings_.mode == FlightRecorderSettings::TRIGGERED ? frozen_ : trigger != 0;
+    if (incident && !triggered)
+    {
+      triggered = true;
+      flush(true);
+      last_flush = steady_clock::now();
+    }
+    else if (settings_.mode == FlightRecorderSettings::CONTINUOUS && steady_clock::now() - last_flush >= flush_period)
+    {
+      flush(false);
+      last_flush = steady_clock::now();
+    }
+
+    if (!running)
+    {
+      return;
+    }
+    if (!drained)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
+
+void FlightRecorder::flush(bool sync)
+{
+  msync(file_, file_size_, sync ? MS_SYNC : MS_ASYNC);
+}
+
+bool FlightRecorder::load(const std::string& path, std::vector<FlightRecord>& records,
+                          FlightRecordFileHeader& header, std::string& error)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+  {
+    error = "Cannot open flight recorder file '" + path + "'.";
+    return false;
+  }
+
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+  {
+    error = "Flight recorder file '" + path + "' is too short.";
+    return false;
+  }
+  if (header.magic != FlightRecordFileHeader::MAGIC || header.version != FlightRecordFileHeader::VERSION ||
+      header.record_size != sizeof(FlightRecord) || header.capacity == 0)
+  {
+    error = "Flight recorder file '" + path + "' has an unknown layout.";
+    return false;
+  }
+
+  records.resize(header.capacity);
+  if (!file.read(reinterpret_cast<char*>(records.data()), header.capacity * sizeof(FlightRecord)))
+  {
+    error = "Flight recorder file '" + path + "' is truncated.";
+    return false;
+  }
+
+  // Put the oldest record first
+  if (header.written > header.capacity)
+  {
+    std::rotate(records.begin(), records.begin() + header.written % header.capacity, records.end());
+  }
+  else
+  {
+    records.resize(header.written);
+  }
+  return true;
+}
+}  // namespace cartesian_ros_control
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <unistd.h>
+
+#include <cartesian_flight_recorder/flight_recorder.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+std::string filePath(const std::string& test)
+{
+  return "/tmp/cartesian_flight_recorder_" + test + "_" + std::to_string(getpid()) + ".bin";
+}
+
+/**
+ * @brief A twist command handle on its own buffers
+ */
+struct Robot
+{
+  geometry_msgs::Pose pose;
+  geometry_msgs::Twist twist;
+  geometry_msgs::Accel accel;
+  geometry_msgs::Accel jerk;
+  geometry_msgs::Twist command;
+  geometry_msgs::Pose pose_command;
+  TwistCommandHandle twist_handle;
+  PoseCommandHandle pose_handle;
+
+  Robot()
+  {
+    CartesianStateHandle state("base", "tool0", &pose, &twist, &accel, &jerk);
+    twist_handle = TwistCommandHandle(state, &command);
+    pose_handle = PoseCommandHandle(state, &pose_command);
+  }
+};
+
+void recordCycles(FlightRecorder& recorder, Robot& robot, int from, int to)
+{
+  for (int i = from; i <= to; ++i)
+  {
+    robot.pose.position.x = i;
+    robot.twist.angular.z = -i;
+    robot.command.linear.y = 0.5 * i;
+    recorder.record(ros::Time(i), robot.twist_handle);
+  }
+}
+}  // namespace
+
+TEST(FlightRecorderTest, TestRecordAndLoad)
+{
+  const std::string path = filePath("load");
+  Robot robot;
+  robot.pose.orientation.w = 1.0;
+  robot.pose_command.position.z = 0.7;
+
+  FlightRecorderSettings settings;
+  settings.path = path;
+  settings.records = 10;
+  std::string error;
+  FlightRecorder recorder;
+  ASSERT_TRUE(recorder.open(settings, error)) << error;
+  EXPECT_TRUE(recorder.isOpen());
+
+  const double input_twist[6] = { 0.1, 0.0, 0.0, 0.0, 0.0, -0.2 };
+  const double input_rotation[4] = { 0.0, 0.0, 1.0, 0.0 };
+  const FlightRecordInput input = { input_twist, input_rotation, 42, false };
+  recorder.record(ros::Time(1), robot.twist_handle, &input);
+  recorder.record(ros::Time(2), robot.pose_handle);
+  const FlightRecordInput tool_input = { input_twist, input_rotation, 43, true };
+  recorder.record(ros::Time(3), robot.twist_handle, &tool_input);
+  recorder.close();
+  EXPECT_FALSE(recorder.isOpen());
+
+  std::vector<FlightRecord> records;
+  FlightRecordFileHeader header;
+  ASSERT_TRUE(FlightRecorder::load(path, records, header, error)) << error;
+  EXPECT_EQ(10u, header.capacity);
+  EXPECT_EQ(3u, header.written);
+  EXPECT_EQ(0u, header.trigger);
+  EXPECT_EQ(0u, header.dropped);
+  ASSERT_EQ(3u, records.size());
+
+  EXPECT_EQ(1u, records[0].cycle);
+  EXPECT_EQ(1000000000, records[0].stamp);
+  EXPECT_DOUBLE_EQ(1.0, records[0].pose[6]);
+  EXPECT_EQ(FlightRecord::TWIST_COMMAND | FlightRecord::TWIST_INPUT, records[0].flags);
+  EXPECT_DOUBLE_EQ(-0.2, records[0].input_twist[5]);
+  EXPECT_DOUBLE_EQ(1.0, records[0].input_rotation[2]);
+  EXPECT_EQ(42, records[0].input_stamp);
+
+  // Pose command handles record the commanded pose along with the state
+  EXPECT_EQ(2u, records[1].cycle);
+  EXPECT_EQ(FlightRecord::POSE_COMMAND, records[1].flags);
+  EXPECT_DOUBLE_EQ(0.7, records[1].pose_command[2]);
+  EXPECT_DOUBLE_EQ(0.0, records[1].pose[2]);
+
+  // Tool frame inputs don't need a rotation
+  EXPECT_EQ(FlightRecord::TWIST_COMMAND | FlightRecord::TWIST_INPUT | FlightRecord::INPUT_IN_TOOL_FRAME,
+            records[2].flags);
+  EXPECT_DOUBLE_EQ(0.0, records[2].input_rotation[2]);
+  EXPECT_DOUBLE_EQ(1.0, records[2].input_rotation[3]);
+
+  std::remove(path.c_str());
+}
+
+TEST(FlightRecorderTest, TestContinuousKeepsLatest)
+{
+  const std::string path = filePath("continuous");
+  Robot robot;
+
+  FlightRecorderSettings settings;
+  settings.path = path;
+  settings.records = 10;
+  settings.queue_size = 64;
+  std::string error;
+  FlightRecorder recorder;
+  ASSERT_TRUE(recorder.open(settings, error)) << error;
+  recordCycles(recorder, robot, 1, 25);
+  recorder.trigger();
+  recorder.close();
+
+  std::vector<FlightRecord> records;
+  FlightRecordFileHeader header;
+  ASSERT_TRUE(FlightRecorder::load(path, records, header, error)) << error;
+  EXPECT_EQ(25u, header.written);
+  EXPECT_EQ(0u, header.dropped);
+  EXPECT_EQ(25u, header.trigger);
+  ASSERT_EQ(10u, records.size());
+
+  // Oldest first, without gaps
+  EXPECT_EQ(25u, records.back().cycle);
+  for (size_t i = 1; i < records.size(); ++i)
+  {
+    EXPECT_EQ(records[i - 1].cycle + 1, records[i].cycle);
+  }
+  EXPECT_DOUBLE_EQ(25.0, records.back().pose[0]);
+  EXPECT_DOUBLE_EQ(-25.0, records.back().twist[5]);
+  EXPECT_DOUBLE_EQ(12.5, records.back().twist_command[1]);
+
+  std::remove(path.c_str());
+}
+
+TEST(FlightRecorderTest, TestTriggeredFreezes)
+{
+  const std::string path = filePath("triggered");
+  Robot robot;
+
+  FlightRecorderSettings settings;
+  settings.path = path;
+  settings.mode = FlightRecorderSettings::TRIGGERED;
+  settings.records = 20;
+  settings.queue_size = 256;
+  settings.post_trigger_records = 5;
+  std::string error;
+  FlightRecorder recorder;
+  ASSERT_TRUE(recorder.open(settings, error)) << error;
+
+  // Ignored without a recorded cycle
+  recorder.trigger();
+
+  recordCycles(recorder, robot, 1, 50);
+  recorder.trigger();
+  recorder.trigger();
+  recordCycles(recorder, robot, 51, 100);
+  recorder.close();
+
+  std::vector<FlightRecord> records;
+  FlightRecordFileHeader header;
+  ASSERT_TRUE(FlightRecorder::load(path, records, header, error)) << error;
+  EXPECT_EQ(0u, header.dropped);
+  EXPECT_EQ(50u, header.trigger);
+  ASSERT_EQ(20u, records.size());
+
+  // The history around the incident survives the cycles after it
+  EXPECT_EQ(36u, records.front().cycle);
+  EXPECT_EQ(55u, records.back().cycle);
+
+  std::remove(path.c_str());
+}
+
+TEST(FlightRecorderTest, TestRejectInvalidFiles)
+{
+  std::vector<FlightRecord> records;
+  FlightRecordFileHeader header;
+  std::string error;
+  EXPECT_FALSE(FlightRecorder::load(filePath("missing"), records, header, error));
+  EXPECT_FALSE(error.empty());
+
+  const std::string path = filePath("invalid");
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "not a flight record, but long enough to hold a header";
+  }
+  error.clear();
+  EXPECT_FALSE(FlightRecorder::load(path, records, header, error));
+  EXPECT_FALSE(error.empty());
+  std::remove(path.c_str());
+
+  FlightRecorderSettings settings;
+  FlightRecorder recorder;
+  EXPECT_FALSE(recorder.open(settings, error));
+  EXPECT_FALSE(recorder.isOpen());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
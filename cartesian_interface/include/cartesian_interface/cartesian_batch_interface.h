@@ -0,0 +1,292 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+#include <hardware_interface/internal/hardware_resource_manager.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Contiguous storage for the Cartesian states and commands of several frames
+ *
+ * Each quantity lives in its own array with one column per frame:
+ * positions (x, y, z), orientations (x, y, z, w), twists, accelerations,
+ * jerks and twist commands (linear x, y, z, angular x, y, z). Implementers
+ * of the hardware_interface::RobotHW class keep one instance and expose it
+ * through batch handles.
+ */
+struct CartesianBatchBuffers
+{
+  explicit CartesianBatchBuffers(size_t frames = 0)
+  {
+    resize(frames);
+  }
+
+  void resize(size_t frames)
+  {
+    positions.assign(3 * frames, 0.0);
+    orientations.assign(4 * frames, 0.0);
+    for (size_t i = 0; i < frames; ++i)
+    {
+      orientations[4 * i + 3] = 1.0;
+    }
+    twists.assign(6 * frames, 0.0);
+    accels.assign(6 * frames, 0.0);
+    jerks.assign(6 * frames, 0.0);
+    twist_commands.assign(6 * frames, 0.0);
+  }
+
+  std::vector<double> positions;
+  std::vector<double> orientations;
+  std::vector<double> twists;
+  std::vector<double> accels;
+  std::vector<double> jerks;
+  std::vector<double> twist_commands;
+};
+
+/**
+ * @brief A handle for reading the Cartesian states of several frames at once
+ *
+ * Instead of one CartesianStateHandle per frame, this handle covers N
+ * frames in a single resource. All frames share one reference frame. Their
+ * states are exposed as Eigen maps with one column per frame over
+ * contiguous arrays, so that controllers process all frames in one
+ * cache-friendly pass and Eigen can vectorize across frames.
+ *
+ * Frame ids are looked up once with index(), e.g. during controller
+ * initialization, and columns are accessed by index afterwards.
+ */
+class CartesianStateBatchHandle
+{
+public:
+  typedef Eigen::Map<const Eigen::Matrix<double, 3, Eigen::Dynamic>> ConstPositions;
+  typedef Eigen::Map<const Eigen::Matrix<double, 4, Eigen::Dynamic>> ConstOrientations;
+  typedef Eigen::Map<const Eigen::Matrix<double, 6, Eigen::Dynamic>> ConstTwists;
+
+  CartesianStateBatchHandle() = default;
+
+  /**
+   * @brief Cover all frames in \a buffers
+   *
+   * @param name Resource name of the batch, e.g. "arms"
+   * @param ref_frame_id Reference frame of all states
+   * @param frame_ids One frame id per column of \a buffers
+   * @param buffers Storage that must outlive this handle
+   */
+  CartesianStateBatchHandle(const std::string& name, const std::string& ref_frame_id,
+                            const std::vector<std::string>& frame_ids, const CartesianBatchBuffers* buffers)
+    : name_(name)
+    , ref_frame_id_(ref_frame_id)
+    , frame_ids_(frame_ids)
+    , buffers_(buffers)
+  {
+    if (!buffers)
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian batch handle '" + name +
+                                                           "'. Buffers pointer is null.");
+    }
+    if (buffers->positions.size() != 3 * frame_ids.size() || buffers->orientations.size() != 4 * frame_ids.size() ||
+        buffers->twists.size() != 6 * frame_ids.size() || buffers->accels.size() != 6 * frame_ids.size() ||
+        buffers->jerks.size() != 6 * frame_ids.size())
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian batch handle '" + name +
+                                                           "'. Buffers don't match the number of frames.");
+    }
+  }
+
+  std::string getName() const
+  {
+    return name_;
+  }
+
+  std::string getReferenceFrame() const
+  {
+    return ref_frame_id_;
+  }
+
+  const std::vector<std::string>& getFrameIds() const
+  {
+    return frame_ids_;
+  }
+
+  /**
+   * @brief Number of frames
+   */
+  size_t size() const
+  {
+    return frame_ids_.size();
+  }
+
+  /**
+   * @brief Column of \a frame_id in all maps
+   *
+   * @return -1 if this batch doesn't cover \a frame_id
+   */
+  int index(const std::string& frame_id) const
+  {
+    for (size_t i = 0; i < frame_ids_.size(); ++i)
+    {
+      if (frame_ids_[i] == frame_id)
+      {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
+  ConstPositions getPositions() const
+  {
+    assert(buffers_);
+    return ConstPositions(buffers_->positions.data(), 3, size());
+  }
+
+  /**
+   * @brief Orientations as quaternion coefficients (x, y, z, w)
+   */
+  ConstOrientations getOrientations() const
+  {
+    assert(buffers_);
+    return ConstOrientations(buffers_->orientations.data(), 4, size());
+  }
+
+  ConstTwists getTwists() const
+  {
+    assert(buffers_);
+    return ConstTwists(buffers_->twists.data(), 6, size());
+  }
+
+  ConstTwists getAccels() const
+  {
+    assert(buffers_);
+    return ConstTwists(buffers_->accels.data(), 6, size());
+  }
+
+  ConstTwists getJerks() const
+  {
+    assert(buffers_);
+    return ConstTwists(buffers_->jerks.data(), 6, size());
+  }
+
+private:
+  std::string name_;
+  std::string ref_frame_id_;
+  std::vector<std::string> frame_ids_;
+  const CartesianBatchBuffers* buffers_ = { nullptr };
+};
+
+/**
+ * @brief A handle for commanding the twists of several frames at once
+ *
+ * Twist commands share the layout of CartesianStateBatchHandle::getTwists()
+ * and are expressed in the batch's reference frame.
+ */
+class TwistCommandBatchHandle : public CartesianStateBatchHandle
+{
+public:
+  typedef Eigen::Map<Eigen::Matrix<double, 6, Eigen::Dynamic>> Twists;
+
+  TwistCommandBatchHandle() = default;
+
+  /**
+   * @brief Command the frames of \a state_handle
+   *
+   * @param state_handle The batch to command
+   * @param buffers The storage that \a state_handle reads from
+   */
+  TwistCommandBatchHandle(const CartesianStateBatchHandle& state_handle, CartesianBatchBuffers* buffers)
+    : CartesianStateBatchHandle(state_handle), command_buffers_(buffers)
+  {
+    if (!buffers || buffers->twist_commands.size() != 6 * state_handle.size())
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create twist command batch handle '" +
+                                                           state_handle.getName() + "'. Invalid command buffer.");
+    }
+    if (buffers->twists.data() != state_handle.getTwists().data())
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create twist command batch handle '" +
+                                                           state_handle.getName() +
+                                                           "'. Buffers differ from those of the state handle.");
+    }
+  }
+
+  /**
+   * @brief Writable twist commands with one column per frame
+   */
+  Twists getTwistCommands()
+  {
+    assert(command_buffers_);
+    return Twists(command_buffers_->twist_commands.data(), 6, size());
+  }
+
+  /**
+   * @brief Set all twist commands in one go
+   */
+  template <typename Derived>
+  void setTwistCommands(const Eigen::MatrixBase<Derived>& twists)
+  {
+    getTwistCommands() = twists;
+  }
+
+private:
+  CartesianBatchBuffers* command_buffers_ = { nullptr };  ///< The state handle's buffers, but writable
+};
+
+/**
+ * @brief A Cartesian state interface for batches of frames
+ */
+class CartesianStateBatchInterface : public hardware_interface::HardwareResourceManager<CartesianStateBatchHandle>
+{
+};
+
+/**
+ * @brief A Cartesian command interface for the twists of batches of frames
+ */
+class TwistCommandBatchInterface
+  : public hardware_interface::HardwareResourceManager<TwistCommandBatchHandle, hardware_interface::ClaimResources>
+{
+};
+
+}  // namespace cartesian_ros_control
@@ -39,6 +39,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include <cartesian_interface/cartesian_state_handle.h>
 
 namespace cartesian_ros_control
@@ -63,7 +67,6 @@ public:
                                                            state_handle.getName() + "'. Command data pointer is null.");
     }
   }
-  virtual ~PoseCommandHandle() = default;
 
   void setPose(const geometry_msgs::Pose& pose)
   {
@@ -71,7 +74,7 @@ public:
     *cmd_ = pose;
   }
 
-  geometry_msgs::Pose getPose() const
+  const geometry_msgs::Pose& getPose() const
   {
     assert(cmd_);
     return *cmd_;
@@ -105,7 +108,6 @@ public:
                                                            state_handle.getName() + "'. Command data pointer is null.");
     }
   }
-  virtual ~TwistCommandHandle() = default;
 
   void setTwist(const geometry_msgs::Twist& twist)
   {
@@ -113,7 +115,7 @@ public:
     *cmd_ = twist;
   }
 
-  geometry_msgs::Twist getTwist() const
+  const geometry_msgs::Twist& getTwist() const
   {
     assert(cmd_);
     return *cmd_;
@@ -128,6 +130,256 @@ private:
   geometry_msgs::Twist* cmd_ = { nullptr };
 };
 
+/**
+ * @brief A handle for setting acceleration commands
+ *
+ * Cartesian ROS-controllers can use this handle to write their control signals
+ * to the according AccelCommandInterface.
+ */
+class AccelCommandHandle : public CartesianStateHandle
+{
+public:
+  AccelCommandHandle() = default;
+  AccelCommandHandle(const CartesianStateHandle& state_handle, geometry_msgs::Accel* cmd)
+    : CartesianStateHandle(state_handle), cmd_(cmd)
+  {
+    if (!cmd)
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create accel command handle for frame '" +
+                                                           state_handle.getName() + "'. Command data pointer is null.");
+    }
+  }
+
+  void setAccel(const geometry_msgs::Accel& accel)
+  {
+    assert(cmd_);
+    *cmd_ = accel;
+  }
+
+  const geometry_msgs::Accel& getAccel() const
+  {
+    assert(cmd_);
+    return *cmd_;
+  }
+  const geometry_msgs::Accel* getAccelPtr() const
+  {
+    assert(cmd_);
+    return cmd_;
+  }
+
+private:
+  geometry_msgs::Accel* cmd_ = { nullptr };
+};
+
+/**
+ * @brief A handle for setting jerk commands
+ *
+ * Cartesian ROS-controllers can use this handle to write their control signals
+ * to the according JerkCommandInterface.
+ */
+class JerkCommandHandle : public CartesianStateHandle
+{
+public:
+  JerkCommandHandle() = default;
+  JerkCommandHandle(const CartesianStateHandle& state_handle, geometry_msgs::Accel* cmd)
+    : CartesianStateHandle(state_handle), cmd_(cmd)
+  {
+    if (!cmd)
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create jerk command handle for frame '" +
+                                                           state_handle.getName() + "'. Command data pointer is null.");
+    }
+  }
+
+  void setJerk(const geometry_msgs::Accel& jerk)
+  {
+    assert(cmd_);
+    *cmd_ = jerk;
+  }
+
+  const geometry_msgs::Accel& getJerk() const
+  {
+    assert(cmd_);
+    return *cmd_;
+  }
+  const geometry_msgs::Accel* getJerkPtr() const
+  {
+    assert(cmd_);
+    return cmd_;
+  }
+
+private:
+  geometry_msgs::Accel* cmd_ = { nullptr };
+};
+
+/**
+ * @brief A handle for setting poses with twist and acceleration feed-forward
+ *
+ * Cartesian ROS-controllers can use this handle to write a complete
+ * trajectory setpoint in one call to the according
+ * PoseTwistAccelCommandInterface. Drivers then obtain the velocity and
+ * acceleration feed-forward directly instead of differentiating the
+ * commanded poses.
+ */
+class PoseTwistAccelCommandHandle : public CartesianStateHandle
+{
+public:
+  PoseTwistAccelCommandHandle() = default;
+  PoseTwistAccelCommandHandle(const CartesianStateHandle& state_handle, geometry_msgs::Pose* pose_cmd,
+                              geometry_msgs::Twist* twist_cmd, geometry_msgs::Accel* accel_cmd)
+    : CartesianStateHandle(state_handle), pose_cmd_(pose_cmd), twist_cmd_(twist_cmd), accel_cmd_(accel_cmd)
+  {
+    if (!pose_cmd)
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create pose/twist/accel command handle for frame '" +
+                                                           state_handle.getName() + "'. Pose data pointer is null.");
+    }
+    if (!twist_cmd)
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create pose/twist/accel command handle for frame '" +
+                                                           state_handle.getName() + "'. Twist data pointer is null.");
+    }
+    if (!accel_cmd)
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create pose/twist/accel command handle for frame '" +
+                                                           state_handle.getName() + "'. Accel data pointer is null.");
+    }
+  }
+
+  void setCommand(const geometry_msgs::Pose& pose, const geometry_msgs::Twist& twist, const geometry_msgs::Accel& accel)
+  {
+    assert(pose_cmd_ && twist_cmd_ && accel_cmd_);
+    *pose_cmd_ = pose;
+    *twist_cmd_ = twist;
+    *accel_cmd_ = accel;
+  }
+
+  const geometry_msgs::Pose& getPose() const
+  {
+    assert(pose_cmd_);
+    return *pose_cmd_;
+  }
+  const geometry_msgs::Twist& getTwist() const
+  {
+    assert(twist_cmd_);
+    return *twist_cmd_;
+  }
+  const geometry_msgs::Accel& getAccel() const
+  {
+    assert(accel_cmd_);
+    return *accel_cmd_;
+  }
+  const geometry_msgs::Pose* getPosePtr() const
+  {
+    assert(pose_cmd_);
+    return pose_cmd_;
+  }
+  const geometry_msgs::Twist* getTwistPtr() const
+  {
+    assert(twist_cmd_);
+    return twist_cmd_;
+  }
+  const geometry_msgs::Accel* getAccelPtr() const
+  {
+    assert(accel_cmd_);
+    return accel_cmd_;
+  }
+
+private:
+  geometry_msgs::Pose* pose_cmd_ = { nullptr };
+  geometry_msgs::Twist* twist_cmd_ = { nullptr };
+  geometry_msgs::Accel* accel_cmd_ = { nullptr };
+};
+
+static_assert(std::is_trivially_copyable<PoseTwistAccelCommandHandle>::value,
+              "PoseTwistAccelCommandHandle is not trivially copyable");
+
+/**
+ * @brief A handle for setting joint posture commands of redundant robots
+ *
+ * Cartesian ROS-controllers can use this handle alongside a Cartesian
+ * command to pull the robot's joints towards a preferred posture. Drivers
+ * pursue the posture only as a secondary objective, e.g. in the null space
+ * of the Jacobian, so that it never disturbs the Cartesian motion.
+ *
+ * The handle covers the joints from getJointNames(). Each joint has a
+ * posture position and a weight, where zero weights leave the joint free.
+ * Resolve joint names once with index() outside the real-time loop and
+ * address joints by index afterwards.
+ */
+class PostureCommandHandle : public CartesianStateHandle
+{
+public:
+  PostureCommandHandle() = default;
+  PostureCommandHandle(const CartesianStateHandle& state_handle, const std::vector<std::string>& joint_names,
+                       double* positions, double* weights)
+    : CartesianStateHandle(state_handle), joint_names_(joint_names), positions_(positions), weights_(weights)
+  {
+    if (!positions || !weights)
+    {
+      throw hardware_interface::HardwareInterfaceException("Cannot create posture command handle for frame '" +
+                                                           state_handle.getName() + "'. Command data pointer is null.");
+    }
+  }
+
+  const std::vector<std::string>& getJointNames() const
+  {
+    return joint_names_;
+  }
+
+  /**
+   * @brief Index of \a joint_name for setPosture()
+   *
+   * @return -1 if the handle doesn't cover \a joint_name
+   */
+  int index(const std::string& joint_name) const
+  {
+    for (size_t i = 0; i < joint_names_.size(); ++i)
+    {
+      if (joint_names_[i] == joint_name)
+      {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Pull joint \a index towards \a position
+   */
+  void setPosture(size_t index, double position, double weight = 1.0)
+  {
+    assert(positions_ && weights_ && index < joint_names_.size());
+    positions_[index] = position;
+    weights_[index] = weight;
+  }
+
+  /**
+   * @brief Leave all joints free
+   */
+  void clearPosture()
+  {
+    assert(weights_);
+    std::fill(weights_, weights_ + joint_names_.size(), 0.0);
+  }
+
+  const double* getPosturePositions() const
+  {
+    assert(positions_);
+    return positions_;
+  }
+  const double* getPostureWeights() const
+  {
+    assert(weights_);
+    return weights_;
+  }
+
+private:
+  std::vector<std::string> joint_names_;
+  double* positions_ = { nullptr };
+  double* weights_ = { nullptr };
+};
+
 /**
  * @brief A Cartesian command interface for poses
  *
@@ -135,8 +387,7 @@ private:
  * mechanisms to set poses as commands in the hardware_interface::RobotHW
  * abstraction.
  */
-class PoseCommandInterface
-  : public hardware_interface::HardwareResourceManager<PoseCommandHandle, hardware_interface::ClaimResources>
+class PoseCommandInterface : public FrameResourceManager<PoseCommandHandle, hardware_interface::ClaimResources>
 {
 };
 
@@ -147,8 +398,52 @@ class PoseCommandInterface
  * mechanisms to set twists as commands in the hardware_interface::RobotHW
  * abstraction.
  */
-class TwistCommandInterface
-  : public hardware_interface::HardwareResourceManager<TwistCommandHandle, hardware_interface::ClaimResources>
+class TwistCommandInterface : public FrameResourceManager<TwistCommandHandle, hardware_interface::ClaimResources>
+{
+};
+
+/**
+ * @brief A Cartesian command interface for accelerations
+ *
+ * Use an instance of this class to provide Cartesian ROS-controllers with
+ * mechanisms to set accelerations as commands in the hardware_interface::RobotHW
+ * abstraction.
+ */
+class AccelCommandInterface : public FrameResourceManager<AccelCommandHandle, hardware_interface::ClaimResources>
+{
+};
+
+/**
+ * @brief A Cartesian command interface for jerks
+ *
+ * Use an instance of this class to provide Cartesian ROS-controllers with
+ * mechanisms to set jerks as commands in the hardware_interface::RobotHW
+ * abstraction.
+ */
+class JerkCommandInterface : public FrameResourceManager<JerkCommandHandle, hardware_interface::ClaimResources>
+{
+};
+
+/**
+ * @brief A Cartesian command interface for poses with twist and acceleration feed-forward
+ *
+ * Use an instance of this class to provide Cartesian ROS-controllers with
+ * mechanisms to set complete trajectory setpoints as commands in the
+ * hardware_interface::RobotHW abstraction.
+ */
+class PoseTwistAccelCommandInterface
+  : public FrameResourceManager<PoseTwistAccelCommandHandle, hardware_interface::ClaimResources>
+{
+};
+
+/**
+ * @brief A command interface for joint postures of redundant robots
+ *
+ * Use an instance of this class to provide Cartesian ROS-controllers with
+ * mechanisms to set preferred joint postures in the
+ * hardware_interface::RobotHW abstraction.
+ */
+class PostureCommandInterface : public FrameResourceManager<PostureCommandHandle, hardware_interface::ClaimResources>
 {
 };
 }  // namespace cartesian_ros_control
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <geometry_msgs/Accel.h>
+#include <geometry_msgs/Pose.h>
+#include <geometry_msgs/Twist.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A snapshot of the full Cartesian state of one frame
+ *
+ * All fields stem from the same hardware read cycle when obtained through
+ * CartesianStateHandle::getState() with a CartesianStateBuffer attached.
+ */
+struct CartesianState
+{
+  geometry_msgs::Pose pose;
+  geometry_msgs::Twist twist;
+  geometry_msgs::Accel accel;
+  geometry_msgs::Accel jerk;
+};
+
+/**
+ * @brief A seqlock-protected double buffer for publishing consistent Cartesian states
+ *
+ * Implementers of the hardware_interface::RobotHW class publish() the
+ * current state once at the end of their read() function. Any number of
+ * controllers can then read() consistent snapshots, even if the hardware
+ * read runs in a separate thread.
+ *
+ * There is a single writer. It alternates between two slots, so readers of
+ * the most recently published slot never wait for an ongoing publish(). A
+ * reader only retries if the writer completes a publish() and starts the
+ * next one while the reader is still copying, i.e. if a full hardware cycle
+ * fits into a single snapshot copy. Neither side ever blocks or allocates.
+ *
+ * Each field is placed on its own cache line, so a snapshot costs one
+ * cache-line-sized copy per field.
+ */
+class CartesianStateBuffer
+{
+public:
+  CartesianStateBuffer() = default;
+  CartesianStateBuffer(const CartesianStateBuffer&) = delete;
+  CartesianStateBuffer& operator=(const CartesianStateBuffer&) = delete;
+
+  /**
+   * @brief Publish a new state. Must only be called from a single thread.
+   */
+  void publish(const geometry_msgs::Pose& pose, const geometry_msgs::Twist& twist, const geometry_msgs::Accel& accel,
+               const geometry_msgs::Accel& jerk)
+  {
+    const uint32_t next = 1 - latest_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[next];
+
+    const uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.pose = pose;
+    slot.twist = twist;
+    slot.accel = accel;
+    slot.jerk = jerk;
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+    latest_.store(next, std::memory_order_release);
+  }
+
+  void publish(const CartesianState& state)
+  {
+    publish(state.pose, state.twist, state.accel, state.jerk);
+  }
+
+  /**
+   * @brief Copy the most recently published state into \a state
+   */
+  void read(CartesianState& state) const
+  {
+    for (;;)
+    {
+      const Slot& slot = slots_[latest_.load(std::memory_order_acquire)];
+      const uint32_t seq = slot.seq.load(std::memory_order_acquire);
+      if (seq & 1u)
+      {
+        continue;
+      }
+
+      state.pose = slot.pose;
+      state.twist = slot.twist;
+      state.accel = slot.accel;
+      state.jerk = slot.jerk;
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) == seq)
+      {
+        return;
+      }
+    }
+  }
+
+  CartesianState read() const
+  {
+    CartesianState state;
+    read(state);
+    return state;
+  }
+
+private:
+  struct Slot
+  {
+    // The sequence counter shares its cache line with the 56 bytes of pose.
+    alignas(64) std::atomic<uint32_t> seq = { 0 };
+    geometry_msgs::Pose pose;
+    alignas(64) geometry_msgs::Twist twist;
+    alignas(64) geometry_msgs::Accel accel;
+    alignas(64) geometry_msgs::Accel jerk;
+  };
+
+  Slot slots_[2];
+  alignas(64) std::atomic<uint32_t> latest_ = { 0 };
+};
+
+}  // namespace cartesian_ros_control
@@ -39,15 +39,28 @@
 
 #pragma once
 
+#include <type_traits>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
 #include <geometry_msgs/Accel.h>
 #include <geometry_msgs/Pose.h>
 #include <geometry_msgs/Twist.h>
 #include <hardware_interface/hardware_interface.h>
 #include <hardware_interface/internal/hardware_resource_manager.h>
 
+#include <cartesian_interface/cartesian_state_buffer.h>
+#include <cartesian_interface/frame_id.h>
+#include <cartesian_interface/frame_resource_manager.h>
+
 namespace cartesian_ros_control
 {
 
+// The Eigen views below map directly onto the message fields.
+static_assert(sizeof(geometry_msgs::Point) == 3 * sizeof(double), "geometry_msgs::Point is not three packed doubles");
+static_assert(sizeof(geometry_msgs::Quaternion) == 4 * sizeof(double),
+              "geometry_msgs::Quaternion is not four packed doubles");
+
 /**
  * @brief A state handle for Cartesian hardware interfaces
  *
@@ -58,6 +71,16 @@ namespace cartesian_ros_control
  * buffers to this handle upon instantiation and register this handle with an
  * instance of the according CartesianStateInterface.
  *
+ * If the hardware reads its state in a separate thread, it can additionally
+ * provide a CartesianStateBuffer that it publishes to once per read().
+ * Controllers then obtain consistent snapshots through getState().
+ *
+ * The other getters return references, pointers and Eigen views directly
+ * into the hardware buffers and never copy.
+ *
+ * Frame names are kept as interned FrameIds. Handles are trivially
+ * copyable and fit into a cache line, so they are cheap to store and copy
+ * in bulk.
  */
 class CartesianStateHandle
 {
@@ -65,73 +88,167 @@ public:
   CartesianStateHandle() = default;
   CartesianStateHandle(const std::string& ref_frame_id, const std::string& frame_id, const geometry_msgs::Pose* pose,
                        const geometry_msgs::Twist* twist, const geometry_msgs::Accel* accel,
-                       const geometry_msgs::Accel* jerk)
-    : frame_id_(frame_id), ref_frame_id_(ref_frame_id), pose_(pose), twist_(twist), accel_(accel), jerk_(jerk)
+                       const geometry_msgs::Accel* jerk, const CartesianStateBuffer* state_buffer = nullptr)
+    : CartesianStateHandle(FrameId(ref_frame_id), FrameId(frame_id), pose, twist, accel, jerk, state_buffer)
+  {
+  }
+  CartesianStateHandle(const FrameId& ref_frame_id, const FrameId& frame_id, const geometry_msgs::Pose* pose,
+                       const geometry_msgs::Twist* twist, const geometry_msgs::Accel* accel,
+                       const geometry_msgs::Accel* jerk, const CartesianStateBuffer* state_buffer = nullptr)
+    : frame_id_(frame_id)
+    , ref_frame_id_(ref_frame_id)
+    , pose_(pose)
+    , twist_(twist)
+    , accel_(accel)
+    , jerk_(jerk)
+    , state_buffer_(state_buffer)
   {
     if (!pose)
     {
-      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" + frame_id_ +
-                                                           "'. Pose data pointer is null.");
+      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" +
+                                                           frame_id.name() + "'. Pose data pointer is null.");
     }
     if (!twist)
     {
-      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" + frame_id_ +
-                                                           "'. Twist data pointer is null.");
+      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" +
+                                                           frame_id.name() + "'. Twist data pointer is null.");
     }
     if (!accel)
     {
-      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" + frame_id_ +
-                                                           "'. Accel data pointer is null.");
+      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" +
+                                                           frame_id.name() + "'. Accel data pointer is null.");
     }
     if (!jerk)
     {
-      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" + frame_id_ +
-                                                           "'. Jerk data pointer is null.");
+      throw hardware_interface::HardwareInterfaceException("Cannot create Cartesian handle for frame '" +
+                                                           frame_id.name() + "'. Jerk data pointer is null.");
     }
   }
-  virtual ~CartesianStateHandle() = default;
 
-  std::string getName() const
+  const std::string& getName() const
+  {
+    return frame_id_.name();
+  }
+  /**
+   * @brief The frame in which pose, twist and higher derivatives are expressed
+   */
+  const std::string& getReferenceFrame() const
+  {
+    return ref_frame_id_.name();
+  }
+  FrameId getFrameId() const
   {
     return frame_id_;
   }
-  geometry_msgs::Pose getPose() const
+  FrameId getReferenceFrameId() const
+  {
+    return ref_frame_id_;
+  }
+  const geometry_msgs::Pose& getPose() const
   {
     assert(pose_);
     return *pose_;
   }
-  geometry_msgs::Twist getTwist() const
+  const geometry_msgs::Twist& getTwist() const
   {
     assert(twist_);
     return *twist_;
   }
-  geometry_msgs::Accel getAccel() const
+  const geometry_msgs::Accel& getAccel() const
   {
     assert(accel_);
     return *accel_;
   }
-  geometry_msgs::Accel getJerk() const
+  const geometry_msgs::Accel& getJerk() const
   {
     assert(jerk_);
     return *jerk_;
   }
+  const geometry_msgs::Pose* getPosePtr() const
+  {
+    assert(pose_);
+    return pose_;
+  }
+  const geometry_msgs::Twist* getTwistPtr() const
+  {
+    assert(twist_);
+    return twist_;
+  }
+  const geometry_msgs::Accel* getAccelPtr() const
+  {
+    assert(accel_);
+    return accel_;
+  }
+  const geometry_msgs::Accel* getJerkPtr() const
+  {
+    assert(jerk_);
+    return jerk_;
+  }
+
+  /**
+   * @brief Get a read-only Eigen view on the position buffer without copying
+   */
+  Eigen::Map<const Eigen::Vector3d> getPositionMap() const
+  {
+    assert(pose_);
+    return Eigen::Map<const Eigen::Vector3d>(&pose_->position.x);
+  }
+
+  /**
+   * @brief Get a read-only Eigen view on the orientation buffer without copying
+   *
+   * Both geometry_msgs::Quaternion and Eigen::Quaterniond store their
+   * coefficients in x, y, z, w order.
+   */
+  Eigen::Map<const Eigen::Quaterniond> getOrientationMap() const
+  {
+    assert(pose_);
+    return Eigen::Map<const Eigen::Quaterniond>(&pose_->orientation.x);
+  }
+
+  /**
+   * @brief Get pose, twist, accel and jerk in one go
+   *
+   * The snapshot is consistent if the hardware provided a
+   * CartesianStateBuffer. Otherwise, the fields are copied one after another
+   * from the individual buffers.
+   */
+  CartesianState getState() const
+  {
+    if (state_buffer_)
+    {
+      return state_buffer_->read();
+    }
+    assert(pose_ && twist_ && accel_ && jerk_);
+    CartesianState state;
+    state.pose = *pose_;
+    state.twist = *twist_;
+    state.accel = *accel_;
+    state.jerk = *jerk_;
+    return state;
+  }
 
 private:
-  std::string frame_id_;
-  std::string ref_frame_id_;
-  const geometry_msgs::Pose* pose_;
-  const geometry_msgs::Twist* twist_;
-  const geometry_msgs::Accel* accel_;
-  const geometry_msgs::Accel* jerk_;
+  FrameId frame_id_;
+  FrameId ref_frame_id_;
+  const geometry_msgs::Pose* pose_ = { nullptr };
+  const geometry_msgs::Twist* twist_ = { nullptr };
+  const geometry_msgs::Accel* accel_ = { nullptr };
+  const geometry_msgs::Accel* jerk_ = { nullptr };
+  const CartesianStateBuffer* state_buffer_ = { nullptr };
 };
 
+static_assert(std::is_trivially_copyable<CartesianStateHandle>::value,
+              "CartesianStateHandle is not trivially copyable");
+static_assert(sizeof(CartesianStateHandle) <= 64, "CartesianStateHandle exceeds a cache line");
+
 /**
  * @brief A Cartesian state interface for hardware_interface::RobotHW abstractions
  *
  * This interface can be passed to Cartesian ROS-controllers as hardware type during initialization.
  * The controllers then obtain read access to the underlying buffers via the \a CartesianStateHandle.
  */
-class CartesianStateInterface : public hardware_interface::HardwareResourceManager<CartesianStateHandle>
+class CartesianStateInterface : public FrameResourceManager<CartesianStateHandle>
 {
 };
 }  // namespace cartesian_ros_control
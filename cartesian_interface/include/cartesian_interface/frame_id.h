@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cartesian_ros_control
+{
+namespace internal
+{
+/**
+ * @brief Process-wide table of interned frame names
+ *
+ * Names are never removed, so references to them stay valid for the
+ * lifetime of the process.
+ */
+class FrameRegistry
+{
+public:
+  static FrameRegistry& instance()
+  {
+    static FrameRegistry registry;
+    return registry;
+  }
+
+  uint32_t intern(const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end())
+    {
+      return it->second;
+    }
+    const uint32_t id = names_.size();
+    names_.push_back(name);
+    ids_.emplace(name, id);
+    return id;
+  }
+
+  const std::string& name(uint32_t id)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_[id];
+  }
+
+private:
+  FrameRegistry() = default;
+
+  std::mutex mutex_;
+  std::deque<std::string> names_;  ///< Stable references on push_back
+  std::unordered_map<std::string, uint32_t> ids_;
+};
+}  // namespace internal
+
+/**
+ * @brief An interned frame name
+ *
+ * Constructing a FrameId from a name looks it up in a process-wide table
+ * once, e.g. when registering handles or initializing controllers. The id
+ * itself is a small integer that is cheap to copy and compare. Ids are
+ * handed out in registration order, starting from zero, so they can index
+ * dense arrays.
+ */
+class FrameId
+{
+public:
+  /**
+   * @brief An invalid id with an empty name
+   */
+  FrameId() = default;
+
+  explicit FrameId(const std::string& name) : id_(internal::FrameRegistry::instance().intern(name))
+  {
+  }
+
+  bool valid() const
+  {
+    return id_ != INVALID;
+  }
+
+  uint32_t value() const
+  {
+    return id_;
+  }
+
+  /**
+   * @brief The interned name. Takes a lock, so don't call this in real-time.
+   */
+  const std::string& name() const
+  {
+    static const std::string empty;
+    return valid() ? internal::FrameRegistry::instance().name(id_) : empty;
+  }
+
+  bool operator==(const FrameId& other) const
+  {
+    return id_ == other.id_;
+  }
+  bool operator!=(const FrameId& other) const
+  {
+    return id_ != other.id_;
+  }
+  bool operator<(const FrameId& other) const
+  {
+    return id_ < other.id_;
+  }
+
+private:
+  static constexpr uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+  uint32_t id_ = { INVALID };
+};
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include <hardware_interface/internal/hardware_resource_manager.h>
+
+#include <cartesian_interface/frame_id.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A hardware resource manager for Cartesian handles with O(1) lookup by FrameId
+ *
+ * Besides the usual lookup by name, handles can be looked up by their
+ * interned FrameId, which simply indexes an array. Controllers with many
+ * frames intern their frame names once and then switch handles without
+ * string comparisons.
+ *
+ * Handles that only reach the base class, e.g. when ros_control combines
+ * the interfaces of several RobotHWs, are found through the name lookup
+ * instead.
+ */
+template <class ResourceHandle, class ClaimPolicy = hardware_interface::DontClaimResources>
+class FrameResourceManager : public hardware_interface::HardwareResourceManager<ResourceHandle, ClaimPolicy>
+{
+public:
+  typedef hardware_interface::HardwareResourceManager<ResourceHandle, ClaimPolicy> Base;
+  using Base::getHandle;
+
+  void registerHandle(const ResourceHandle& handle)
+  {
+    Base::registerHandle(handle);
+
+    const uint32_t id = handle.getFrameId().value();
+    if (id >= registered_.size())
+    {
+      handles_.resize(id + 1);
+      registered_.resize(id + 1, false);
+    }
+    handles_[id] = handle;
+    registered_[id] = true;
+  }
+
+  /**
+   * @brief Get the handle of \a frame_id, claiming it if the interface claims resources
+   */
+  ResourceHandle getHandle(const FrameId& frame_id)
+  {
+    const uint32_t id = frame_id.value();
+    if (!frame_id.valid() || id >= registered_.size() || !registered_[id])
+    {
+      return Base::getHandle(frame_id.name());
+    }
+    if (std::is_same<ClaimPolicy, hardware_interface::ClaimResources>::value)
+    {
+      this->claim(frame_id.name());
+    }
+    return handles_[id];
+  }
+
+private:
+  std::vector<ResourceHandle> handles_;
+  std::vector<bool> registered_;
+};
+
+}  // namespace cartesian_ros_control
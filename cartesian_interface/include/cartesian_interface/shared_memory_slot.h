@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A twist command for shared memory ingress
+ *
+ * Plain data with a fixed layout, so that producers in other processes
+ * don't need ROS.
+ */
+struct SharedTwistCommand
+{
+  enum Frame : uint32_t
+  {
+    REFERENCE_FRAME = 0,  ///< The handle's reference frame
+    CONTROLLED_FRAME = 1  ///< The handle's own frame, e.g. for jogging in tool coordinates
+  };
+
+  double twist[6];  ///< Linear x, y, z followed by angular x, y, z
+  int64_t stamp;    ///< Creation time in nanoseconds since the epoch of ros::Time, i.e. CLOCK_REALTIME
+  uint32_t frame;   ///< One of Frame
+  uint32_t reserved;
+};
+
+/**
+ * @brief A single-value seqlock in POSIX shared memory
+ *
+ * One process writes values of \a T into the slot at its own rate, and
+ * another one reads the latest value, e.g. from a real-time loop. Neither
+ * side blocks or makes system calls after open(). Writers never wait for
+ * readers, and a reader that overlaps with a write retries a bounded
+ * number of times before giving up for that cycle.
+ *
+ * The segment starts with a magic number, a layout version and the
+ * payload's size, which open() checks, so that mismatched producers and
+ * consumers are rejected instead of misreading each other. Payloads are
+ * copied as relaxed atomic words, so that torn reads are detected by the
+ * sequence counter without data races.
+ *
+ * At most one process may write at a time. \a T must be trivially
+ * copyable and is best kept free of pointers and padding.
+ */
+template <typename T>
+class SharedMemorySlot
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Shared memory payloads must be trivially copyable");
+  static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory needs lock-free 64 bit atomics");
+
+public:
+  static constexpr uint32_t MAGIC = 0x43525353;  // "CRSS"
+  static constexpr uint32_t VERSION = 1;
+
+  SharedMemorySlot() = default;
+  SharedMemorySlot(const SharedMemorySlot&) = delete;
+  SharedMemorySlot& operator=(const SharedMemorySlot&) = delete;
+
+  ~SharedMemorySlot()
+  {
+    close();
+  }
+
+  /**
+   * @brief Map the segment \a name, e.g. "/twist_command"
+   *
+   * @param create Create the segment if it doesn't exist and remove it again in close()
+   * @param error Human readable reason on failure
+   *
+   * @return True on success
+   */
+  bool open(const std::string& name, bool create, std::string& error)
+  {
+    close();
+    const int fd = shm_open(name.c_str(), create ? (O_RDWR | O_CREAT) : O_RDWR, 0660);
+    if (fd < 0)
+    {
+      error = "Cannot open shared memory '" + name + "': " + std::strerror(errno);
+      return false;
+    }
+
+    struct stat status;
+    bool initialize = false;
+    if (fstat(fd, &status) != 0)
+    {
+      error = "Cannot inspect shared memory '" + name + "': " + std::strerror(errno);
+      ::close(fd);
+      return false;
+    }
+    if (status.st_size == 0 && create)
+    {
+      if (ftruncate(fd, sizeof(Segment)) != 0)
+      {
+        error = "Cannot resize shared memory '" + name + "': " + std::strerror(errno);
+        ::close(fd);
+        return false;
+      }
+      initialize = true;
+    }
+    else if (status.st_size != static_cast<off_t>(sizeof(Segment)))
+    {
+      error = "Shared memory '" + name + "' has an unexpected size.";
+      ::close(fd);
+      return false;
+    }
+
+    void* memory = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED)
+    {
+      error = "Cannot map shared memory '" + name + "': " + std::strerror(errno);
+      return false;
+    }
+    segment_ = static_cast<Segment*>(memory);
+
+    if (initialize)
+    {
+      segment_->version = VERSION;
+      segment_->size = sizeof(T);
+      segment_->sequence.store(0, std::memory_order_relaxed);
+      segment_->magic.store(MAGIC, std::memory_order_release);
+    }
+    else if (segment_->magic.load(std::memory_order_acquire) != MAGIC || segment_->version != VERSION ||
+             segment_->size != sizeof(T))
+    {
+      error = "Shared memory '" + name + "' has an incompatible layout.";
+      close();
+      return false;
+    }
+
+    if (create)
+    {
+      name_ = name;
+    }
+    last_sequence_ = 0;
+    return true;
+  }
+
+  /**
+   * @brief Unmap the segment, and remove it if this side created it
+   */
+  void close()
+  {
+    if (segment_)
+    {
+      munmap(segment_, sizeof(Segment));
+      segment_ = nullptr;
+    }
+    if (!name_.empty())
+    {
+      shm_unlink(name_.c_str());
+      name_.clear();
+    }
+  }
+
+  bool isOpen() const
+  {
+    return segment_ != nullptr;
+  }
+
+  /**
+   * @brief Publish \a value. Writer side only.
+   */
+  void write(const T& value)
+  {
+    uint64_t words[WORDS] = {};
+    std::memcpy(words, &value, sizeof(T));
+
+    const uint64_t sequence = segment_->sequence.load(std::memory_order_relaxed);
+    segment_->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; ++i)
+    {
+      segment_->payload[i].store(words[i], std::memory_order_relaxed);
+    }
+    segment_->sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief Read the latest value if there is a new one. Reader side only.
+   *
+   * Wait-free. Returns false if nothing was written since the last
+   * successful read, or if every attempt overlapped with a write.
+   */
+  bool read(T& value)
+  {
+    for (int attempt = 0; attempt < MAX_ATTEMPTS; ++attempt)
+    {
+      const uint64_t before = segment_->sequence.load(std::memory_order_acquire);
+      if (before == last_sequence_)
+      {
+        return false;
+      }
+      if (before & 1)
+      {
+        continue;
+      }
+
+      uint64_t words[WORDS];
+      for (size_t i = 0; i < WORDS; ++i)
+      {
+        words[i] = segment_->payload[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (segment_->sequence.load(std::memory_order_relaxed) == before)
+      {
+        std::memcpy(&value, words, sizeof(T));
+        last_sequence_ = before;
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  static constexpr int MAX_ATTEMPTS = 4;
+
+  struct Segment
+  {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t size;
+    uint32_t reserved;
+    alignas(64) std::atomic<uint64_t> sequence;  ///< Odd while a write is in progress
+    std::atomic<uint64_t> payload[WORDS];
+  };
+
+  Segment* segment_ = { nullptr };
+  std::string name_;  ///< Set if we created the segment
+  uint64_t last_sequence_ = { 0 };
+};
+
+}  // namespace cartesian_ros_control
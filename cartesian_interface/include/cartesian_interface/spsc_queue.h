@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A bounded, wait-free single-producer single-consumer queue
+ *
+ * Memory is allocated once in the constructor or in reset(). Afterwards,
+ * push() and pop() never allocate or block, so one side can safely live in
+ * a real-time loop. Exactly one thread may push and exactly one thread may
+ * pop at a time.
+ *
+ * The capacity is rounded up to the next power of two. Types with alignment
+ * requirements, such as fixed-size Eigen members, can pass a suitable
+ * \a Allocator.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class SpscQueue
+{
+public:
+  SpscQueue() = default;
+  explicit SpscQueue(size_t capacity)
+  {
+    reset(capacity);
+  }
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  /**
+   * @brief Drop all elements and reallocate for \a capacity elements
+   *
+   * Not thread-safe. Call this only while neither side is active.
+   */
+  void reset(size_t capacity)
+  {
+    size_t size = 1;
+    while (size < capacity)
+    {
+      size <<= 1;
+    }
+    buffer_.assign(size, T());
+    mask_ = size - 1;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Append \a value. Producer side only.
+   *
+   * @return False if the queue is full
+   */
+  bool push(const T& value)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) >= buffer_.size())
+    {
+      return false;
+    }
+    buffer_[tail & mask_] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest element into \a value. Consumer side only.
+   *
+   * @return False if the queue is empty
+   */
+  bool pop(T& value)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    value = buffer_[head & mask_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest element without copying it. Consumer side only.
+   *
+   * @return False if the queue is empty
+   */
+  bool pop()
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief The oldest element without removing it. Consumer side only.
+   *
+   * @return Null if the queue is empty
+   */
+  const T* front() const
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+    {
+      return nullptr;
+    }
+    return &buffer_[head & mask_];
+  }
+
+  /**
+   * @brief Number of queued elements. Exact only when called from either side.
+   */
+  size_t size() const
+  {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+
+  bool empty() const
+  {
+    return size() == 0;
+  }
+
+  size_t capacity() const
+  {
+    return buffer_.size();
+  }
+
+private:
+  std::vector<T, Allocator> buffer_;
+  size_t mask_ = { 0 };
+
+  // Producer and consumer indices on separate cache lines. Both only ever grow.
+  alignas(64) std::atomic<size_t> head_ = { 0 };
+  alignas(64) std::atomic<size_t> tail_ = { 0 };
+};
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A wait-free triple buffer for handing the latest value from one thread to another
+ *
+ * The writer fills getWriteBuffer() in place and hands it over with
+ * publish(). The reader picks up the latest published value with update()
+ * and reads it from getReadBuffer(). Values published in between are
+ * skipped. Neither side ever blocks, allocates or copies, so large messages
+ * can be preallocated once and then filled in a real-time loop.
+ *
+ * Each buffer keeps whatever the writer left in it. Fields that the writer
+ * never touches, such as constant strings, only need to be set once through
+ * the constructor. Exactly one thread may write and exactly one thread may
+ * read at a time.
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+  TripleBuffer() = default;
+  explicit TripleBuffer(const T& initial) : buffers_{ { initial, initial, initial } }
+  {
+  }
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  /**
+   * @brief Fill all buffers with \a value and forget pending updates
+   *
+   * Not thread-safe. Call this only while neither side is active.
+   */
+  void reset(const T& value)
+  {
+    buffers_.fill(value);
+    write_ = 0;
+    middle_.store(1, std::memory_order_relaxed);
+    read_ = 2;
+  }
+
+  /**
+   * @brief The buffer to fill next. Writer side only.
+   */
+  T& getWriteBuffer()
+  {
+    return buffers_[write_];
+  }
+
+  /**
+   * @brief Hand the write buffer over to the reader. Writer side only.
+   */
+  void publish()
+  {
+    write_ = middle_.exchange(write_ | DIRTY, std::memory_order_acq_rel) & INDEX;
+  }
+
+  /**
+   * @brief Pick up the latest published value. Reader side only.
+   *
+   * @return False if nothing was published since the last update()
+   */
+  bool update()
+  {
+    if (!(middle_.load(std::memory_order_relaxed) & DIRTY))
+    {
+      return false;
+    }
+    read_ = middle_.exchange(read_, std::memory_order_acq_rel) & INDEX;
+    return true;
+  }
+
+  /**
+   * @brief The value picked up by the last update(). Reader side only.
+   */
+  const T& getReadBuffer() const
+  {
+    return buffers_[read_];
+  }
+
+private:
+  enum : uint8_t
+  {
+    INDEX = 3,
+    DIRTY = 4
+  };
+
+  std::array<T, 3> buffers_;
+  uint8_t write_ = { 0 };
+  std::atomic<uint8_t> middle_ = { 1 };  ///< Index of the buffer in between, plus the DIRTY flag
+  uint8_t read_ = { 2 };
+};
+
+}  // namespace cartesian_ros_control
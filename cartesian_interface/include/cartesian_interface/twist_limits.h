@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+#include <ros/ros.h>
+
+namespace cartesian_ros_control
+{
+
+typedef Eigen::Matrix<double, 6, 1> Vector6d;
+
+/**
+ * @brief Per-axis velocity, acceleration and jerk limits
+ *
+ * Axes are ordered linear x, y, z followed by angular x, y, z. A limit of
+ * zero leaves the axis unlimited in that derivative.
+ */
+struct TwistLimits
+{
+  TwistLimits()
+    : velocity(Vector6d::Zero())
+    , acceleration(Vector6d::Zero())
+    , jerk(Vector6d::Zero())
+  {
+  }
+
+  Vector6d velocity;
+  Vector6d acceleration;
+  Vector6d jerk;
+};
+
+/**
+ * @brief The acceleration from which ramping down to zero in steps of \a step just covers \a error
+ *
+ * Ramping down from step * (k + f) through step * f covers
+ * step * period * ((k + 1) * f + k * (k + 1) / 2), so that the last cycle
+ * lands exactly on the goal without exceeding the jerk limit. Jerk-limited
+ * shaping that never heads for more than this can't overshoot.
+ *
+ * @param error Velocity error to close
+ * @param step Largest change of acceleration per cycle, i.e. max jerk * \a period
+ * @param period Cycle period in seconds
+ */
+inline double brakingAccel(double error, double step, double period)
+{
+  const double covered = std::abs(error) / (step * period);
+  const double k = std::floor(0.5 * (std::sqrt(1.0 + 8.0 * covered) - 1.0));
+  const double f = (covered - 0.5 * k * (k + 1.0)) / (k + 1.0);
+  return std::copysign(step * (k + f), error);
+}
+
+/**
+ * @brief Read one limit per axis from parameter \a name
+ *
+ * A missing parameter leaves all axes unlimited. Anything but six
+ * non-negative values is logged and rejected.
+ */
+inline bool readLimits(const ros::NodeHandle& n, const std::string& name, Vector6d& limits)
+{
+  std::vector<double> values;
+  if (!n.getParam(name, values))
+  {
+    limits.setZero();
+    return true;
+  }
+
+  if (values.size() != 6)
+  {
+    ROS_ERROR_STREAM("Parameter " << n.resolveName(name) << " needs 6 values (linear x, y, z, angular x, y, z).");
+    return false;
+  }
+
+  for (size_t i = 0; i < 6; ++i)
+  {
+    if (values[i] < 0.0)
+    {
+      ROS_ERROR_STREAM("Parameter " << n.resolveName(name) << " must not be negative.");
+      return false;
+    }
+    limits[i] = values[i];
+  }
+  return true;
+}
+
+/**
+ * @brief Read the \a max_velocity, \a max_acceleration and \a max_jerk parameters
+ */
+inline bool readTwistLimits(const ros::NodeHandle& n, TwistLimits& limits)
+{
+  return readLimits(n, "max_velocity", limits.velocity) && readLimits(n, "max_acceleration", limits.acceleration) &&
+         readLimits(n, "max_jerk", limits.jerk);
+}
+
+}  // namespace cartesian_ros_control
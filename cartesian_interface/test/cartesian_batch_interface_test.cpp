@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cartesian_interface/cartesian_batch_interface.h>
+
+using namespace cartesian_ros_control;
+
+class CartesianBatchInterfaceTest : public ::testing::Test
+{
+protected:
+  std::vector<std::string> frame_ids = { "left_tool0", "right_tool0", "camera" };
+  CartesianBatchBuffers buffers{ 3 };
+};
+
+TEST_F(CartesianBatchInterfaceTest, TestConstructor)
+{
+  EXPECT_NO_THROW(CartesianStateBatchHandle obj("arms", "base", frame_ids, &buffers));
+  EXPECT_THROW(CartesianStateBatchHandle obj("arms", "base", frame_ids, nullptr),
+               hardware_interface::HardwareInterfaceException);
+
+  CartesianBatchBuffers too_small(2);
+  EXPECT_THROW(CartesianStateBatchHandle obj("arms", "base", frame_ids, &too_small),
+               hardware_interface::HardwareInterfaceException);
+
+  CartesianStateBatchHandle state_handle("arms", "base", frame_ids, &buffers);
+  EXPECT_EQ("arms", state_handle.getName());
+  EXPECT_EQ("base", state_handle.getReferenceFrame());
+  EXPECT_EQ(3u, state_handle.size());
+  EXPECT_THROW(TwistCommandBatchHandle obj(state_handle, nullptr), hardware_interface::HardwareInterfaceException);
+  EXPECT_THROW(TwistCommandBatchHandle obj(state_handle, &too_small), hardware_interface::HardwareInterfaceException);
+
+  // Commands must go to the same storage the state comes from
+  CartesianBatchBuffers other(3);
+  EXPECT_THROW(TwistCommandBatchHandle obj(state_handle, &other), hardware_interface::HardwareInterfaceException);
+  EXPECT_NO_THROW(TwistCommandBatchHandle obj(state_handle, &buffers));
+}
+
+TEST_F(CartesianBatchInterfaceTest, TestIndexLookup)
+{
+  CartesianStateBatchHandle handle("arms", "base", frame_ids, &buffers);
+  EXPECT_EQ(0, handle.index("left_tool0"));
+  EXPECT_EQ(2, handle.index("camera"));
+  EXPECT_EQ(-1, handle.index("unknown"));
+}
+
+TEST_F(CartesianBatchInterfaceTest, TestStateMapsFollowBuffers)
+{
+  CartesianStateBatchHandle handle("arms", "base", frame_ids, &buffers);
+
+  // Identity orientations by default
+  EXPECT_TRUE(handle.getOrientations().row(3).isOnes());
+
+  const int right = handle.index("right_tool0");
+  buffers.positions[3 * right + 2] = 1.5;
+  buffers.twists[6 * right + 4] = 0.2;
+  buffers.accels[6 * right] = 3.0;
+  buffers.jerks[6 * right + 5] = 4.0;
+
+  EXPECT_DOUBLE_EQ(1.5, handle.getPositions()(2, right));
+  EXPECT_DOUBLE_EQ(0.2, handle.getTwists()(4, right));
+  EXPECT_DOUBLE_EQ(3.0, handle.getAccels()(0, right));
+  EXPECT_DOUBLE_EQ(4.0, handle.getJerks()(5, right));
+  EXPECT_DOUBLE_EQ(0.0, handle.getPositions().col(0).norm());
+}
+
+TEST_F(CartesianBatchInterfaceTest, TestSetTwistCommands)
+{
+  CartesianStateBatchHandle state_handle("arms", "base", frame_ids, &buffers);
+  TwistCommandBatchHandle handle(state_handle, &buffers);
+
+  Eigen::Matrix<double, 6, 3> twists;
+  twists.setRandom();
+  handle.setTwistCommands(twists);
+  for (size_t i = 0; i < 18; ++i)
+  {
+    EXPECT_DOUBLE_EQ(twists.data()[i], buffers.twist_commands[i]);
+  }
+
+  // All frames in one pass
+  handle.getTwistCommands() *= 0.5;
+  EXPECT_DOUBLE_EQ(0.5 * twists(3, 1), buffers.twist_commands[6 + 3]);
+}
+
+TEST_F(CartesianBatchInterfaceTest, TestInterfaces)
+{
+  CartesianStateBatchInterface state_interface;
+  TwistCommandBatchInterface command_interface;
+  CartesianStateBatchHandle state_handle("arms", "base", frame_ids, &buffers);
+  state_interface.registerHandle(state_handle);
+  command_interface.registerHandle(TwistCommandBatchHandle(state_handle, &buffers));
+
+  EXPECT_EQ(3u, state_interface.getHandle("arms").size());
+  TwistCommandBatchHandle handle = command_interface.getHandle("arms");
+  handle.getTwistCommands().setConstant(1.0);
+  EXPECT_DOUBLE_EQ(1.0, buffers.twist_commands.back());
+  EXPECT_THROW(command_interface.getHandle("legs"), hardware_interface::HardwareInterfaceException);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
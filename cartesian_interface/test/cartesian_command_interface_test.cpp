@@ -97,6 +97,16 @@ TEST_F(CartesianCommandInterfaceTest, TestPoseHandleDataHandling)
   EXPECT_DOUBLE_EQ(new_cmd.orientation.w, cmd_handle.getPose().orientation.w);
 }
 
+TEST_F(CartesianCommandInterfaceTest, TestClaimByFrameId)
+{
+  PoseCommandInterface iface;
+  iface.registerHandle(PoseCommandHandle(state_handle, &pose_cmd_buffer));
+
+  PoseCommandHandle cmd_handle = iface.getHandle(FrameId(controlled_frame));
+  EXPECT_EQ(&pose_cmd_buffer, cmd_handle.getPosePtr());
+  EXPECT_EQ(1u, iface.getClaims().count(controlled_frame));
+}
+
 TEST_F(CartesianCommandInterfaceTest, TestTwistHandleConstructor)
 {
   EXPECT_NO_THROW(TwistCommandHandle obj(state_handle, &twist_cmd_buffer));
@@ -131,6 +141,158 @@ TEST_F(CartesianCommandInterfaceTest, TestTwistHandleDataHandling)
   EXPECT_DOUBLE_EQ(new_cmd.angular.z, cmd_handle.getTwist().angular.z);
 }
 
+TEST_F(CartesianCommandInterfaceTest, TestAccelHandleConstructor)
+{
+  EXPECT_NO_THROW(AccelCommandHandle obj(state_handle, &accel_cmd_buffer));
+  EXPECT_THROW(AccelCommandHandle obj(state_handle, nullptr), hardware_interface::HardwareInterfaceException);
+}
+
+TEST_F(CartesianCommandInterfaceTest, TestAccelHandleDataHandling)
+{
+  AccelCommandHandle cmd_handle(state_handle, &accel_cmd_buffer);
+
+  AccelCommandInterface iface;
+  iface.registerHandle(cmd_handle);
+
+  EXPECT_NO_THROW(iface.getHandle(controlled_frame));
+
+  cmd_handle = iface.getHandle(controlled_frame);
+
+  EXPECT_EQ(controlled_frame, cmd_handle.getName());
+  geometry_msgs::Accel new_cmd;
+  new_cmd.linear.x = 1.0;
+  new_cmd.linear.y = 2.0;
+  new_cmd.linear.z = 3.0;
+  new_cmd.angular.x = 0.5;
+  new_cmd.angular.y = 0.5;
+  new_cmd.angular.z = 0.0;
+  cmd_handle.setAccel(new_cmd);
+  EXPECT_DOUBLE_EQ(new_cmd.linear.x, cmd_handle.getAccel().linear.x);
+  EXPECT_DOUBLE_EQ(new_cmd.linear.y, cmd_handle.getAccel().linear.y);
+  EXPECT_DOUBLE_EQ(new_cmd.linear.z, cmd_handle.getAccel().linear.z);
+  EXPECT_DOUBLE_EQ(new_cmd.angular.x, cmd_handle.getAccel().angular.x);
+  EXPECT_DOUBLE_EQ(new_cmd.angular.y, cmd_handle.getAccel().angular.y);
+  EXPECT_DOUBLE_EQ(new_cmd.angular.z, cmd_handle.getAccel().angular.z);
+}
+
+TEST_F(CartesianCommandInterfaceTest, TestJerkHandleConstructor)
+{
+  EXPECT_NO_THROW(JerkCommandHandle obj(state_handle, &jerk_cmd_buffer));
+  EXPECT_THROW(JerkCommandHandle obj(state_handle, nullptr), hardware_interface::HardwareInterfaceException);
+}
+
+TEST_F(CartesianCommandInterfaceTest, TestJerkHandleDataHandling)
+{
+  JerkCommandHandle cmd_handle(state_handle, &jerk_cmd_buffer);
+
+  JerkCommandInterface iface;
+  iface.registerHandle(cmd_handle);
+
+  EXPECT_NO_THROW(iface.getHandle(controlled_frame));
+
+  cmd_handle = iface.getHandle(controlled_frame);
+
+  EXPECT_EQ(controlled_frame, cmd_handle.getName());
+  geometry_msgs::Accel new_cmd;
+  new_cmd.linear.x = 1.0;
+  new_cmd.linear.y = 2.0;
+  new_cmd.linear.z = 3.0;
+  new_cmd.angular.x = 0.5;
+  new_cmd.angular.y = 0.5;
+  new_cmd.angular.z = 0.0;
+  cmd_handle.setJerk(new_cmd);
+  EXPECT_DOUBLE_EQ(new_cmd.linear.x, cmd_handle.getJerk().linear.x);
+  EXPECT_DOUBLE_EQ(new_cmd.linear.y, cmd_handle.getJerk().linear.y);
+  EXPECT_DOUBLE_EQ(new_cmd.linear.z, cmd_handle.getJerk().linear.z);
+  EXPECT_DOUBLE_EQ(new_cmd.angular.x, cmd_handle.getJerk().angular.x);
+  EXPECT_DOUBLE_EQ(new_cmd.angular.y, cmd_handle.getJerk().angular.y);
+  EXPECT_DOUBLE_EQ(new_cmd.angular.z, cmd_handle.getJerk().angular.z);
+}
+
+TEST_F(CartesianCommandInterfaceTest, TestPoseTwistAccelHandleConstructor)
+{
+  EXPECT_NO_THROW(
+      PoseTwistAccelCommandHandle obj(state_handle, &pose_cmd_buffer, &twist_cmd_buffer, &accel_cmd_buffer));
+  EXPECT_THROW(PoseTwistAccelCommandHandle obj(state_handle, nullptr, &twist_cmd_buffer, &accel_cmd_buffer),
+               hardware_interface::HardwareInterfaceException);
+  EXPECT_THROW(PoseTwistAccelCommandHandle obj(state_handle, &pose_cmd_buffer, nullptr, &accel_cmd_buffer),
+               hardware_interface::HardwareInterfaceException);
+  EXPECT_THROW(PoseTwistAccelCommandHandle obj(state_handle, &pose_cmd_buffer, &twist_cmd_buffer, nullptr),
+               hardware_interface::HardwareInterfaceException);
+}
+
+TEST_F(CartesianCommandInterfaceTest, TestPoseTwistAccelHandleDataHandling)
+{
+  PoseTwistAccelCommandHandle cmd_handle(state_handle, &pose_cmd_buffer, &twist_cmd_buffer, &accel_cmd_buffer);
+
+  PoseTwistAccelCommandInterface iface;
+  iface.registerHandle(cmd_handle);
+
+  EXPECT_NO_THROW(iface.getHandle(controlled_frame));
+
+  cmd_handle = iface.getHandle(controlled_frame);
+
+  EXPECT_EQ(controlled_frame, cmd_handle.getName());
+  geometry_msgs::Pose new_pose;
+  new_pose.position.x = 1.0;
+  new_pose.orientation.w = 1.0;
+  geometry_msgs::Twist new_twist;
+  new_twist.linear.y = 2.0;
+  new_twist.angular.z = 0.5;
+  geometry_msgs::Accel new_accel;
+  new_accel.linear.z = 3.0;
+  new_accel.angular.x = 0.25;
+  cmd_handle.setCommand(new_pose, new_twist, new_accel);
+  EXPECT_DOUBLE_EQ(new_pose.position.x, cmd_handle.getPose().position.x);
+  EXPECT_DOUBLE_EQ(new_pose.orientation.w, cmd_handle.getPose().orientation.w);
+  EXPECT_DOUBLE_EQ(new_twist.linear.y, cmd_handle.getTwist().linear.y);
+  EXPECT_DOUBLE_EQ(new_twist.angular.z, cmd_handle.getTwist().angular.z);
+  EXPECT_DOUBLE_EQ(new_accel.linear.z, cmd_handle.getAccel().linear.z);
+  EXPECT_DOUBLE_EQ(new_accel.angular.x, cmd_handle.getAccel().angular.x);
+  EXPECT_DOUBLE_EQ(new_pose.position.x, pose_cmd_buffer.position.x);
+  EXPECT_DOUBLE_EQ(new_twist.linear.y, twist_cmd_buffer.linear.y);
+  EXPECT_DOUBLE_EQ(new_accel.linear.z, accel_cmd_buffer.linear.z);
+}
+
+TEST_F(CartesianCommandInterfaceTest, TestPostureHandleConstructor)
+{
+  std::vector<std::string> joint_names = { "joint1", "joint2" };
+  double positions[2];
+  double weights[2];
+  EXPECT_NO_THROW(PostureCommandHandle obj(state_handle, joint_names, positions, weights));
+  EXPECT_THROW(PostureCommandHandle obj(state_handle, joint_names, nullptr, weights),
+               hardware_interface::HardwareInterfaceException);
+  EXPECT_THROW(PostureCommandHandle obj(state_handle, joint_names, positions, nullptr),
+               hardware_interface::HardwareInterfaceException);
+}
+
+TEST_F(CartesianCommandInterfaceTest, TestPostureHandleDataHandling)
+{
+  std::vector<std::string> joint_names = { "joint1", "joint2", "joint3" };
+  double positions[3] = { 0.0, 0.0, 0.0 };
+  double weights[3] = { 1.0, 1.0, 1.0 };
+
+  PostureCommandInterface iface;
+  iface.registerHandle(PostureCommandHandle(state_handle, joint_names, positions, weights));
+  PostureCommandHandle cmd_handle = iface.getHandle(controlled_frame);
+
+  EXPECT_EQ(joint_names, cmd_handle.getJointNames());
+  EXPECT_EQ(1, cmd_handle.index("joint2"));
+  EXPECT_EQ(-1, cmd_handle.index("joint4"));
+
+  cmd_handle.clearPosture();
+  EXPECT_DOUBLE_EQ(0.0, weights[0]);
+  EXPECT_DOUBLE_EQ(0.0, weights[2]);
+
+  cmd_handle.setPosture(cmd_handle.index("joint3"), 1.5);
+  cmd_handle.setPosture(cmd_handle.index("joint1"), -0.5, 0.25);
+  EXPECT_DOUBLE_EQ(1.5, cmd_handle.getPosturePositions()[2]);
+  EXPECT_DOUBLE_EQ(1.0, cmd_handle.getPostureWeights()[2]);
+  EXPECT_DOUBLE_EQ(-0.5, positions[0]);
+  EXPECT_DOUBLE_EQ(0.25, weights[0]);
+  EXPECT_DOUBLE_EQ(0.0, weights[1]);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -39,6 +39,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include <cartesian_interface/cartesian_state_handle.h>
 
 using namespace cartesian_ros_control;
@@ -66,6 +69,190 @@ TEST(CartesianStateHandleTest, TestConstructor)
   EXPECT_THROW(
       CartesianStateHandle obj(reference_frame, controlled_frame, &pose_buffer, &twist_buffer, &accel_buffer, nullptr),
       hardware_interface::HardwareInterfaceException);
+
+  CartesianStateHandle handle(reference_frame, controlled_frame, &pose_buffer, &twist_buffer, &accel_buffer,
+                              &jerk_buffer);
+  EXPECT_EQ(controlled_frame, handle.getName());
+  EXPECT_EQ(reference_frame, handle.getReferenceFrame());
+}
+
+TEST(CartesianStateHandleTest, TestZeroCopyAccessors)
+{
+  geometry_msgs::Pose pose_buffer;
+  geometry_msgs::Twist twist_buffer;
+  geometry_msgs::Accel accel_buffer;
+  geometry_msgs::Accel jerk_buffer;
+  CartesianStateHandle handle("base", "tool0", &pose_buffer, &twist_buffer, &accel_buffer, &jerk_buffer);
+
+  EXPECT_EQ(&pose_buffer, &handle.getPose());
+  EXPECT_EQ(&twist_buffer, &handle.getTwist());
+  EXPECT_EQ(&accel_buffer, &handle.getAccel());
+  EXPECT_EQ(&jerk_buffer, &handle.getJerk());
+  EXPECT_EQ(&pose_buffer, handle.getPosePtr());
+  EXPECT_EQ(&twist_buffer, handle.getTwistPtr());
+  EXPECT_EQ(&accel_buffer, handle.getAccelPtr());
+  EXPECT_EQ(&jerk_buffer, handle.getJerkPtr());
+
+  pose_buffer.position.x = 1.0;
+  pose_buffer.position.y = 2.0;
+  pose_buffer.position.z = 3.0;
+  pose_buffer.orientation.x = 0.1;
+  pose_buffer.orientation.y = 0.2;
+  pose_buffer.orientation.z = 0.3;
+  pose_buffer.orientation.w = 0.4;
+
+  Eigen::Map<const Eigen::Vector3d> position = handle.getPositionMap();
+  EXPECT_DOUBLE_EQ(1.0, position.x());
+  EXPECT_DOUBLE_EQ(2.0, position.y());
+  EXPECT_DOUBLE_EQ(3.0, position.z());
+
+  Eigen::Map<const Eigen::Quaterniond> orientation = handle.getOrientationMap();
+  EXPECT_DOUBLE_EQ(0.1, orientation.x());
+  EXPECT_DOUBLE_EQ(0.2, orientation.y());
+  EXPECT_DOUBLE_EQ(0.3, orientation.z());
+  EXPECT_DOUBLE_EQ(0.4, orientation.w());
+
+  // The views follow the buffers
+  pose_buffer.position.x = 5.0;
+  EXPECT_DOUBLE_EQ(5.0, position.x());
+}
+
+TEST(CartesianStateHandleTest, TestGetStateWithoutBuffer)
+{
+  geometry_msgs::Pose pose_buffer;
+  geometry_msgs::Twist twist_buffer;
+  geometry_msgs::Accel accel_buffer;
+  geometry_msgs::Accel jerk_buffer;
+  CartesianStateHandle handle("base", "tool0", &pose_buffer, &twist_buffer, &accel_buffer, &jerk_buffer);
+
+  pose_buffer.position.x = 1.0;
+  twist_buffer.linear.y = 2.0;
+  accel_buffer.angular.z = 3.0;
+  jerk_buffer.linear.x = 4.0;
+
+  CartesianState state = handle.getState();
+  EXPECT_DOUBLE_EQ(1.0, state.pose.position.x);
+  EXPECT_DOUBLE_EQ(2.0, state.twist.linear.y);
+  EXPECT_DOUBLE_EQ(3.0, state.accel.angular.z);
+  EXPECT_DOUBLE_EQ(4.0, state.jerk.linear.x);
+}
+
+TEST(CartesianStateHandleTest, TestGetStateFromBuffer)
+{
+  geometry_msgs::Pose pose_buffer;
+  geometry_msgs::Twist twist_buffer;
+  geometry_msgs::Accel accel_buffer;
+  geometry_msgs::Accel jerk_buffer;
+  CartesianStateBuffer state_buffer;
+  CartesianStateHandle handle("base", "tool0", &pose_buffer, &twist_buffer, &accel_buffer, &jerk_buffer,
+                              &state_buffer);
+
+  pose_buffer.position.x = 1.0;
+  twist_buffer.linear.y = 2.0;
+
+  // Nothing published yet
+  EXPECT_DOUBLE_EQ(0.0, handle.getState().pose.position.x);
+
+  state_buffer.publish(pose_buffer, twist_buffer, accel_buffer, jerk_buffer);
+  CartesianState state = handle.getState();
+  EXPECT_DOUBLE_EQ(1.0, state.pose.position.x);
+  EXPECT_DOUBLE_EQ(2.0, state.twist.linear.y);
+
+  // Later changes to the raw buffers are only visible after the next publish
+  pose_buffer.position.x = 5.0;
+  EXPECT_DOUBLE_EQ(1.0, handle.getState().pose.position.x);
+  state_buffer.publish(pose_buffer, twist_buffer, accel_buffer, jerk_buffer);
+  EXPECT_DOUBLE_EQ(5.0, handle.getState().pose.position.x);
+}
+
+TEST(CartesianStateHandleTest, TestFrameIds)
+{
+  FrameId invalid;
+  EXPECT_FALSE(invalid.valid());
+  EXPECT_EQ("", invalid.name());
+
+  FrameId tool("tool0");
+  EXPECT_TRUE(tool.valid());
+  EXPECT_EQ("tool0", tool.name());
+  EXPECT_EQ(tool, FrameId("tool0"));
+  EXPECT_NE(tool, FrameId("tool1"));
+
+  geometry_msgs::Pose pose_buffer;
+  geometry_msgs::Twist twist_buffer;
+  geometry_msgs::Accel accel_buffer;
+  geometry_msgs::Accel jerk_buffer;
+  CartesianStateHandle handle("base", "tool0", &pose_buffer, &twist_buffer, &accel_buffer, &jerk_buffer);
+  EXPECT_EQ(tool, handle.getFrameId());
+  EXPECT_EQ(FrameId("base"), handle.getReferenceFrameId());
+}
+
+TEST(CartesianStateHandleTest, TestLookupByFrameId)
+{
+  std::vector<geometry_msgs::Pose> poses(3);
+  geometry_msgs::Twist twist_buffer;
+  geometry_msgs::Accel accel_buffer;
+  geometry_msgs::Accel jerk_buffer;
+
+  CartesianStateInterface iface;
+  for (size_t i = 0; i < poses.size(); ++i)
+  {
+    poses[i].position.x = i;
+    iface.registerHandle(CartesianStateHandle("base", "frame_" + std::to_string(i), &poses[i], &twist_buffer,
+                                              &accel_buffer, &jerk_buffer));
+  }
+
+  CartesianStateHandle handle = iface.getHandle(FrameId("frame_2"));
+  EXPECT_EQ("frame_2", handle.getName());
+  EXPECT_EQ(&poses[2], handle.getPosePtr());
+  EXPECT_EQ(&poses[1], iface.getHandle("frame_1").getPosePtr());
+  EXPECT_THROW(iface.getHandle(FrameId("frame_3")), hardware_interface::HardwareInterfaceException);
+  EXPECT_THROW(iface.getHandle(FrameId()), hardware_interface::HardwareInterfaceException);
+
+  // Handles that only the base class knows are still found by name
+  iface.hardware_interface::ResourceManager<CartesianStateHandle>::registerHandle(
+      CartesianStateHandle("base", "frame_3", &poses[0], &twist_buffer, &accel_buffer, &jerk_buffer));
+  EXPECT_EQ(&poses[0], iface.getHandle(FrameId("frame_3")).getPosePtr());
+}
+
+TEST(CartesianStateHandleTest, TestConcurrentSnapshotsAreConsistent)
+{
+  CartesianStateBuffer state_buffer;
+  std::atomic<bool> done{ false };
+
+  // The writer fills all fields of a cycle with the same value.
+  std::thread writer([&]() {
+    CartesianState state;
+    for (int i = 1; i <= 100000; ++i)
+    {
+      state.pose.position.x = i;
+      state.pose.orientation.w = i;
+      state.twist.linear.x = i;
+      state.twist.angular.z = i;
+      state.accel.linear.x = i;
+      state.jerk.angular.z = i;
+      state_buffer.publish(state);
+    }
+    done = true;
+  });
+
+  CartesianState state;
+  while (!done)
+  {
+    state_buffer.read(state);
+    const double cycle = state.pose.position.x;
+    if (cycle == 0)
+    {
+      continue;  // Nothing published yet
+    }
+    ASSERT_DOUBLE_EQ(cycle, state.pose.orientation.w);
+    ASSERT_DOUBLE_EQ(cycle, state.twist.linear.x);
+    ASSERT_DOUBLE_EQ(cycle, state.twist.angular.z);
+    ASSERT_DOUBLE_EQ(cycle, state.accel.linear.x);
+    ASSERT_DOUBLE_EQ(cycle, state.jerk.angular.z);
+  }
+  writer.join();
+
+  EXPECT_DOUBLE_EQ(100000, state_buffer.read().pose.position.x);
 }
 
 int main(int argc, char** argv)
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+
+#include <unistd.h>
+
+#include <cartesian_interface/shared_memory_slot.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+std::string segmentName(const std::string& test)
+{
+  return "/cartesian_ros_control_" + test + "_" + std::to_string(getpid());
+}
+
+struct Words
+{
+  uint64_t values[5];
+};
+}  // namespace
+
+TEST(SharedMemorySlotTest, TestOpen)
+{
+  const std::string name = segmentName("open");
+  std::string error;
+
+  SharedMemorySlot<SharedTwistCommand> writer;
+  EXPECT_FALSE(writer.open(name, false, error));
+  EXPECT_FALSE(error.empty());
+  EXPECT_FALSE(writer.isOpen());
+
+  SharedMemorySlot<SharedTwistCommand> reader;
+  ASSERT_TRUE(reader.open(name, true, error)) << error;
+  ASSERT_TRUE(writer.open(name, false, error)) << error;
+
+  // Different payloads don't fit
+  SharedMemorySlot<Words> other;
+  EXPECT_FALSE(other.open(name, false, error));
+
+  // The creator removes the segment
+  reader.close();
+  writer.close();
+  EXPECT_FALSE(writer.open(name, false, error));
+}
+
+TEST(SharedMemorySlotTest, TestReadLatestValueOnce)
+{
+  const std::string name = segmentName("read");
+  std::string error;
+  SharedMemorySlot<SharedTwistCommand> reader;
+  SharedMemorySlot<SharedTwistCommand> writer;
+  ASSERT_TRUE(reader.open(name, true, error)) << error;
+  ASSERT_TRUE(writer.open(name, false, error)) << error;
+
+  SharedTwistCommand command = {};
+  EXPECT_FALSE(reader.read(command));
+
+  command.twist[0] = 0.1;
+  command.twist[5] = -0.2;
+  command.stamp = 42;
+  command.frame = SharedTwistCommand::CONTROLLED_FRAME;
+  writer.write(command);
+  command.twist[0] = 0.3;
+  writer.write(command);
+
+  SharedTwistCommand result = {};
+  ASSERT_TRUE(reader.read(result));
+  EXPECT_DOUBLE_EQ(0.3, result.twist[0]);
+  EXPECT_DOUBLE_EQ(-0.2, result.twist[5]);
+  EXPECT_EQ(42, result.stamp);
+  EXPECT_EQ(SharedTwistCommand::CONTROLLED_FRAME, result.frame);
+  EXPECT_FALSE(reader.read(result));
+}
+
+TEST(SharedMemorySlotTest, TestNoTornReads)
+{
+  const std::string name = segmentName("torn");
+  std::string error;
+  SharedMemorySlot<Words> reader;
+  SharedMemorySlot<Words> writer;
+  ASSERT_TRUE(reader.open(name, true, error)) << error;
+  ASSERT_TRUE(writer.open(name, false, error)) << error;
+
+  const uint64_t count = 200000;
+  std::thread producer([&]() {
+    Words words;
+    for (uint64_t i = 1; i <= count; ++i)
+    {
+      std::fill(std::begin(words.values), std::end(words.values), i);
+      writer.write(words);
+    }
+  });
+
+  Words words;
+  uint64_t last = 0;
+  while (last < count)
+  {
+    if (reader.read(words))
+    {
+      for (uint64_t value : words.values)
+      {
+        ASSERT_EQ(words.values[0], value);
+      }
+      ASSERT_GT(words.values[0], last);
+      last = words.values[0];
+    }
+  }
+  producer.join();
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <cartesian_interface/spsc_queue.h>
+
+using namespace cartesian_ros_control;
+
+TEST(SpscQueueTest, TestCapacity)
+{
+  SpscQueue<int> unallocated;
+  EXPECT_FALSE(unallocated.push(1));
+
+  SpscQueue<int> queue(3);
+  EXPECT_EQ(4u, queue.capacity());
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 4; ++i)
+  {
+    EXPECT_TRUE(queue.push(i));
+  }
+  EXPECT_FALSE(queue.push(4));
+  EXPECT_EQ(4u, queue.size());
+
+  queue.reset(8);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(8u, queue.capacity());
+}
+
+TEST(SpscQueueTest, TestFifoOrder)
+{
+  SpscQueue<int> queue(4);
+  int value = 0;
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_EQ(nullptr, queue.front());
+
+  // Wrap around several times
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_TRUE(queue.push(2 * i));
+    EXPECT_TRUE(queue.push(2 * i + 1));
+    ASSERT_NE(nullptr, queue.front());
+    EXPECT_EQ(2 * i, *queue.front());
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(2 * i, value);
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(2 * i + 1, value);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueueTest, TestPopWithoutCopy)
+{
+  SpscQueue<int> queue(2);
+  EXPECT_FALSE(queue.pop());
+
+  queue.push(1);
+  queue.push(2);
+  EXPECT_TRUE(queue.pop());
+  ASSERT_NE(nullptr, queue.front());
+  EXPECT_EQ(2, *queue.front());
+  EXPECT_TRUE(queue.pop());
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueueTest, TestConcurrentProducerConsumer)
+{
+  const int count = 100000;
+  SpscQueue<int> queue(64);
+
+  std::thread producer([&]() {
+    for (int i = 0; i < count;)
+    {
+      if (queue.push(i))
+      {
+        ++i;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int expected = 0;
+  int value;
+  while (expected < count)
+  {
+    if (queue.pop(value))
+    {
+      ASSERT_EQ(expected, value);
+      ++expected;
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(queue.empty());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
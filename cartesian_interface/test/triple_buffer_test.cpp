@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include <cartesian_interface/triple_buffer.h>
+
+using namespace cartesian_ros_control;
+
+TEST(TripleBufferTest, TestLatestValueWins)
+{
+  TripleBuffer<int> buffer(-1);
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(-1, buffer.getReadBuffer());
+
+  buffer.getWriteBuffer() = 1;
+  buffer.publish();
+  buffer.getWriteBuffer() = 2;
+  buffer.publish();
+
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(2, buffer.getReadBuffer());
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(2, buffer.getReadBuffer());
+
+  // The writer never gets the reader's buffer
+  for (int i = 3; i < 10; ++i)
+  {
+    buffer.getWriteBuffer() = i;
+    EXPECT_NE(&buffer.getWriteBuffer(), &buffer.getReadBuffer());
+    buffer.publish();
+  }
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(9, buffer.getReadBuffer());
+
+  buffer.getWriteBuffer() = 10;
+  buffer.publish();
+  buffer.reset(0);
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(0, buffer.getReadBuffer());
+  EXPECT_EQ(0, buffer.getWriteBuffer());
+}
+
+TEST(TripleBufferTest, TestConcurrentValuesAreConsistent)
+{
+  struct Value
+  {
+    int first = { 0 };
+    int second = { 0 };
+  };
+  TripleBuffer<Value> buffer;
+  std::atomic<bool> done{ false };
+
+  std::thread writer([&]() {
+    for (int i = 1; i <= 100000; ++i)
+    {
+      Value& value = buffer.getWriteBuffer();
+      value.first = i;
+      value.second = i;
+      buffer.publish();
+    }
+    done = true;
+  });
+
+  int last = 0;
+  while (!done)
+  {
+    if (buffer.update())
+    {
+      const Value& value = buffer.getReadBuffer();
+      ASSERT_EQ(value.first, value.second);
+      ASSERT_GE(value.first, last);
+      last = value.first;
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+  writer.join();
+
+  buffer.update();
+  EXPECT_EQ(100000, buffer.getReadBuffer().first);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Estimates acceleration and jerk from twist measurements
+ *
+ * An alpha-beta-gamma filter that runs independently on all six axes of a
+ * twist. Each update() predicts twist, acceleration and jerk over one
+ * period under constant jerk and corrects all three with the measurement
+ * residual. Smaller gains give smoother but more delayed estimates.
+ *
+ * The filter state has a fixed size, so update() never allocates.
+ */
+class AlphaBetaGammaFilter
+{
+public:
+  typedef Eigen::Matrix<double, 6, 1> Vector6d;
+
+  AlphaBetaGammaFilter() = default;
+
+  /**
+   * @brief Set the correction gains for twist, acceleration and jerk
+   */
+  void setGains(double alpha, double beta, double gamma)
+  {
+    alpha_ = alpha;
+    beta_ = beta;
+    gamma_ = gamma;
+  }
+
+  /**
+   * @brief Restart from \a twist at zero acceleration and jerk
+   */
+  void reset(const Vector6d& twist = Vector6d::Zero())
+  {
+    twist_ = twist;
+    accel_.setZero();
+    jerk_.setZero();
+  }
+
+  /**
+   * @brief Incorporate the twist \a measured after \a period seconds
+   */
+  void update(const Vector6d& measured, double period)
+  {
+    if (period <= 0.0)
+    {
+      return;
+    }
+
+    // Predict under constant jerk
+    twist_ += period * (accel_ + 0.5 * period * jerk_);
+    accel_ += period * jerk_;
+
+    // Correct
+    const Vector6d residual = measured - twist_;
+    twist_ += alpha_ * residual;
+    accel_ += (beta_ / period) * residual;
+    jerk_ += (2.0 * gamma_ / (period * period)) * residual;
+  }
+
+  const Vector6d& getTwist() const
+  {
+    return twist_;
+  }
+
+  const Vector6d& getAccel() const
+  {
+    return accel_;
+  }
+
+  const Vector6d& getJerk() const
+  {
+    return jerk_;
+  }
+
+private:
+  double alpha_ = { 0.5 };
+  double beta_ = { 0.1 };
+  double gamma_ = { 0.005 };
+
+  Vector6d twist_ = { Vector6d::Zero() };
+  Vector6d accel_ = { Vector6d::Zero() };
+  Vector6d jerk_ = { Vector6d::Zero() };
+};
+
+}  // namespace cartesian_ros_control
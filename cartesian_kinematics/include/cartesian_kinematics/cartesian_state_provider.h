@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hardware_interface/joint_state_interface.h>
+#include <hardware_interface/robot_hw.h>
+#include <kdl/chain.hpp>
+#include <kdl/chainfksolverpos_recursive.hpp>
+#include <kdl/chainjnttojacsolver.hpp>
+#include <kdl/frames.hpp>
+#include <kdl/jacobian.hpp>
+#include <kdl/jntarray.hpp>
+#include <ros/ros.h>
+
+#include <cartesian_interface/cartesian_state_buffer.h>
+#include <cartesian_interface/cartesian_state_handle.h>
+#include <cartesian_kinematics/alpha_beta_gamma_filter.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Fills a CartesianStateInterface from joint states
+ *
+ * This provider lives inside a hardware_interface::RobotHW. It builds a KDL
+ * chain from the URDF and registers a CartesianStateInterface with a single
+ * handle for the chain's tip, expressed in the chain's base. Call update()
+ * once per cycle after reading the joints. It computes the tip's pose with
+ * forward kinematics and its twist with the Jacobian, and estimates
+ * acceleration and jerk with an AlphaBetaGammaFilter. All Cartesian
+ * controllers then share this result instead of recomputing it.
+ *
+ * The handle carries a CartesianStateBuffer, so that controllers get
+ * consistent snapshots from CartesianStateHandle::getState().
+ *
+ * update() works on preallocated KDL and Eigen workspaces and doesn't
+ * allocate.
+ *
+ * Parameters in the given node handle's namespace:
+ * - \a robot_description: URDF as XML string
+ * - \a base_link, \a tip_link: Ends of the kinematic chain
+ * - \a filter/alpha, \a filter/beta, \a filter/gamma (0.5, 0.1, 0.005):
+ *   Gains of the acceleration and jerk estimation
+ */
+class CartesianStateProvider
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  CartesianStateProvider() = default;
+  CartesianStateProvider(const CartesianStateProvider&) = delete;
+  CartesianStateProvider& operator=(const CartesianStateProvider&) = delete;
+
+  /**
+   * @brief Build the chain and register a CartesianStateInterface with \a hw
+   *
+   * \a hw must already provide a JointStateInterface with all joints of
+   * the chain.
+   *
+   * @return False if parameters or joints are missing
+   */
+  bool init(hardware_interface::RobotHW* hw, const ros::NodeHandle& nh);
+
+  /**
+   * @brief Update the Cartesian state from the joints
+   *
+   * @param period Time since the last update, used for filtering
+   */
+  void update(const ros::Duration& period);
+
+  /**
+   * @brief The handle that is registered with the RobotHW
+   */
+  const CartesianStateHandle& getHandle() const
+  {
+    return handle_;
+  }
+
+  const KDL::Chain& getChain() const
+  {
+    return chain_;
+  }
+
+  /**
+   * @brief Joints of the chain from base to tip
+   */
+  const std::vector<std::string>& getJointNames() const
+  {
+    return joint_names_;
+  }
+
+  /**
+   * @brief Jacobian of the last update(), referring to the tip and expressed in the base
+   */
+  const KDL::Jacobian& getJacobian() const
+  {
+    return jacobian_;
+  }
+
+private:
+  KDL::Chain chain_;
+  std::unique_ptr<KDL::ChainFkSolverPos_recursive> fk_solver_;
+  std::unique_ptr<KDL::ChainJntToJacSolver> jac_solver_;
+  AlphaBetaGammaFilter filter_;
+  bool filter_initialized_ = { false };
+
+  std::vector<std::string> joint_names_;
+  std::vector<hardware_interface::JointStateHandle> joint_handles_;
+  KDL::JntArray positions_;
+  Eigen::VectorXd velocities_;
+  KDL::Frame frame_;
+  KDL::Jacobian jacobian_;
+
+  // Buffers behind the handle
+  geometry_msgs::Pose pose_;
+  geometry_msgs::Twist twist_;
+  geometry_msgs::Accel accel_;
+  geometry_msgs::Accel jerk_;
+  CartesianStateBuffer state_buffer_;
+
+  CartesianStateHandle handle_;
+  CartesianStateInterface state_interface_;
+};
+
+}  // namespace cartesian_ros_control
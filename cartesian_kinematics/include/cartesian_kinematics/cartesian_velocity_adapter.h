@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include <hardware_interface/controller_info.h>
+#include <hardware_interface/joint_command_interface.h>
+#include <hardware_interface/robot_hw.h>
+#include <ros/ros.h>
+
+#include <cartesian_interface/cartesian_command_interface.h>
+#include <cartesian_kinematics/cartesian_state_provider.h>
+#include <cartesian_kinematics/damped_least_squares.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Cartesian interfaces on top of joint velocity hardware
+ *
+ * This adapter lives inside a hardware_interface::RobotHW that only offers
+ * a hardware_interface::VelocityJointInterface. It registers a
+ * CartesianStateInterface through a CartesianStateProvider, plus a
+ * TwistCommandInterface, a PoseCommandInterface and a
+ * PostureCommandInterface for the chain's tip, so that Cartesian
+ * controllers run unchanged on such robots.
+ *
+ * Call read() after reading the joints and write() before writing them.
+ * read() updates the Cartesian state through the provider. write()
+ * resolves the Cartesian command into joint velocities with damped
+ * least-squares differential IK. Pose commands are tracked with a
+ * proportional gain. They are used while a controller that claimed the
+ * pose interface is running, twist commands otherwise. Forward the
+ * RobotHW's doSwitch() to this adapter to keep track of that.
+ *
+ * On redundant chains, posture commands pull the weighted joints towards
+ * their posture positions with \a posture_gain. This motion is projected
+ * into the null space of the Jacobian and leaves the Cartesian motion
+ * untouched. Postures are cleared whenever their controller stops.
+ *
+ * Both read() and write() work on preallocated KDL and Eigen workspaces
+ * and don't allocate.
+ *
+ * Parameters in the given node handle's namespace are those of
+ * CartesianStateProvider and:
+ * - \a damping (0.05): Damping at singularities
+ * - \a singular_threshold (0.01): Smallest singular value without damping
+ * - \a pose_gain (10.0): Proportional gain for pose commands in 1/s
+ * - \a posture_gain (1.0): Proportional gain for posture commands in 1/s
+ */
+class CartesianVelocityAdapter
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  CartesianVelocityAdapter() = default;
+
+  /**
+   * @brief Build the chain and register Cartesian interfaces with \a hw
+   *
+   * \a hw must already provide a JointStateInterface and a
+   * VelocityJointInterface with all joints of the chain.
+   *
+   * @return False if parameters or joints are missing
+   */
+  bool init(hardware_interface::RobotHW* hw, const ros::NodeHandle& nh);
+
+  /**
+   * @brief Update the Cartesian state from the joints
+   *
+   * @param period Time since the last read
+   */
+  void read(const ros::Duration& period);
+
+  /**
+   * @brief Resolve the Cartesian command into joint velocity commands
+   */
+  void write();
+
+  /**
+   * @brief Follow pose or twist commands depending on the running controllers
+   */
+  void doSwitch(const std::list<hardware_interface::ControllerInfo>& start_list,
+                const std::list<hardware_interface::ControllerInfo>& stop_list);
+
+  /**
+   * @brief Joints of the chain from base to tip
+   */
+  const std::vector<std::string>& getJointNames() const
+  {
+    return state_provider_.getJointNames();
+  }
+
+private:
+  CartesianStateProvider state_provider_;
+  DampedLeastSquares ik_solver_;
+  double pose_gain_ = { 10.0 };
+  double posture_gain_ = { 1.0 };
+
+  std::vector<hardware_interface::JointHandle> joint_handles_;
+  Eigen::VectorXd velocity_commands_;
+  Eigen::VectorXd posture_velocities_;
+
+  // Buffers behind the command handles
+  geometry_msgs::Twist twist_command_;
+  geometry_msgs::Pose pose_command_;
+  bool pose_mode_ = { false };
+  Eigen::VectorXd posture_positions_;
+  Eigen::VectorXd posture_weights_;
+
+  TwistCommandInterface twist_interface_;
+  PoseCommandInterface pose_interface_;
+  PostureCommandInterface posture_interface_;
+};
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SVD>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Damped least-squares differential inverse kinematics
+ *
+ * Maps a Cartesian twist onto joint velocities through the singular value
+ * decomposition of the 6 x n Jacobian:
+ *
+ *   q_dot = sum_i s_i / (s_i^2 + lambda^2) * v_i * u_i^T * twist
+ *
+ * The damping lambda stays zero away from singularities and rises smoothly
+ * to \a max_damping once the smallest singular value drops below
+ * \a singular_threshold.
+ *
+ * All workspaces are allocated in init(). solve() does not allocate and is
+ * safe to call in real-time. For redundant chains, we decompose the
+ * transposed Jacobian, because Eigen's SVD allocates for wide matrices.
+ */
+class DampedLeastSquares
+{
+public:
+  typedef Eigen::Matrix<double, 6, Eigen::Dynamic> Jacobian;
+  typedef Eigen::Matrix<double, 6, 1> Twist;
+
+  DampedLeastSquares() = default;
+
+  /**
+   * @brief Allocate workspaces for \a joints joints
+   *
+   * @param joints Number of joints in the chain
+   * @param max_damping Damping lambda at an exact singularity
+   * @param singular_threshold Smallest singular value below which damping starts
+   */
+  void init(int joints, double max_damping, double singular_threshold);
+
+  /**
+   * @brief Solve for the joint velocities that best produce \a twist
+   *
+   * @param jacobian Jacobian with joints() columns
+   * @param twist Linear and angular velocity in the Jacobian's frame
+   * @param joint_velocities Output with joints() elements
+   */
+  void solve(const Jacobian& jacobian, const Twist& twist, Eigen::VectorXd& joint_velocities);
+
+  /**
+   * @brief Solve for \a twist and pursue \a secondary joint velocities in the null space
+   *
+   * Adds the projection of \a secondary onto the null space of the
+   * Jacobian, (I - J^+ J) * secondary, with the same damped pseudo-inverse
+   * J^+ as the primary solution. On redundant chains, this changes the
+   * posture without disturbing the Cartesian motion.
+   *
+   * @param jacobian Jacobian with joints() columns
+   * @param twist Linear and angular velocity in the Jacobian's frame
+   * @param secondary Desired joint velocities with joints() elements
+   * @param joint_velocities Output with joints() elements
+   */
+  void solve(const Jacobian& jacobian, const Twist& twist, const Eigen::VectorXd& secondary,
+             Eigen::VectorXd& joint_velocities);
+
+  int joints() const
+  {
+    return joints_;
+  }
+
+  /**
+   * @brief Damping used in the last call to solve()
+   */
+  double getDamping() const
+  {
+    return damping_;
+  }
+
+private:
+  int joints_ = { 0 };
+  double max_damping_ = { 0.0 };
+  double singular_threshold_ = { 0.0 };
+  double damping_ = { 0.0 };
+
+  bool transposed_ = { false };  ///< Whether we decompose the transposed Jacobian
+  Eigen::MatrixXd workspace_;
+  Eigen::JacobiSVD<Eigen::MatrixXd> svd_;
+  Eigen::VectorXd weighted_;  ///< Damped inverse singular values times U^T * twist
+  Eigen::VectorXd projected_;  ///< Filter factors times V^T * secondary
+};
+
+}  // namespace cartesian_ros_control
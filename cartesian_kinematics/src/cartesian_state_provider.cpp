@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_kinematics/cartesian_state_provider.h>
+
+#include <kdl/tree.hpp>
+#include <kdl_parser/kdl_parser.hpp>
+
+namespace cartesian_ros_control
+{
+bool CartesianStateProvider::init(hardware_interface::RobotHW* hw, const ros::NodeHandle& nh)
+{
+  std::string robot_description;
+  std::string base_link;
+  std::string tip_link;
+  if (!nh.getParam("robot_description", robot_description) || !nh.getParam("base_link", base_link) ||
+      !nh.getParam("tip_link", tip_link))
+  {
+    ROS_ERROR_STREAM("Parameters " << nh.resolveName("robot_description") << ", " << nh.resolveName("base_link")
+                                   << " and " << nh.resolveName("tip_link") << " are required.");
+    return false;
+  }
+
+  KDL::Tree tree;
+  if (!kdl_parser::treeFromString(robot_description, tree))
+  {
+    ROS_ERROR_STREAM("Failed to parse " << nh.resolveName("robot_description") << ".");
+    return false;
+  }
+  if (!tree.getChain(base_link, tip_link, chain_))
+  {
+    ROS_ERROR_STREAM("No kinematic chain from '" << base_link << "' to '" << tip_link << "'.");
+    return false;
+  }
+
+  hardware_interface::JointStateInterface* joint_interface = hw->get<hardware_interface::JointStateInterface>();
+  if (!joint_interface)
+  {
+    ROS_ERROR_STREAM("The robot provides no JointStateInterface.");
+    return false;
+  }
+
+  joint_names_.clear();
+  joint_handles_.clear();
+  for (unsigned int i = 0; i < chain_.getNrOfSegments(); ++i)
+  {
+    const KDL::Joint& joint = chain_.getSegment(i).getJoint();
+    if (joint.getType() == KDL::Joint::None)
+    {
+      continue;
+    }
+    try
+    {
+      joint_handles_.push_back(joint_interface->getHandle(joint.getName()));
+    }
+    catch (const hardware_interface::HardwareInterfaceException& e)
+    {
+      ROS_ERROR_STREAM("Joint '" << joint.getName() << "' of the chain is missing: " << e.what());
+      return false;
+    }
+    joint_names_.push_back(joint.getName());
+  }
+
+  const unsigned int joints = chain_.getNrOfJoints();
+  fk_solver_.reset(new KDL::ChainFkSolverPos_recursive(chain_));
+  jac_solver_.reset(new KDL::ChainJntToJacSolver(chain_));
+  positions_.resize(joints);
+  velocities_.setZero(joints);
+  jacobian_.resize(joints);
+
+  filter_.setGains(nh.param("filter/alpha", 0.5), nh.param("filter/beta", 0.1), nh.param("filter/gamma", 0.005));
+  filter_initialized_ = false;
+
+  handle_ = CartesianStateHandle(base_link, tip_link, &pose_, &twist_, &accel_, &jerk_, &state_buffer_);
+  state_interface_.registerHandle(handle_);
+  hw->registerInterface(&state_interface_);
+
+  update(ros::Duration(0));
+  return true;
+}
+
+void CartesianStateProvider::update(const ros::Duration& period)
+{
+  for (size_t i = 0; i < joint_handles_.size(); ++i)
+  {
+    positions_(i) = joint_handles_[i].getPosition();
+    velocities_[i] = joint_handles_[i].getVelocity();
+  }
+
+  fk_solver_->JntToCart(positions_, frame_);
+  jac_solver_->JntToJac(positions_, jacobian_);
+
+  pose_.position.x = frame_.p.x();
+  pose_.position.y = frame_.p.y();
+  pose_.position.z = frame_.p.z();
+  frame_.M.GetQuaternion(pose_.orientation.x, pose_.orientation.y, pose_.orientation.z, pose_.orientation.w);
+
+  // KDL's Jacobian refers to the tip and is expressed in the base, same as our twists
+  AlphaBetaGammaFilter::Vector6d twist;
+  twist.noalias() = jacobian_.data * velocities_;
+  twist_.linear.x = twist[0];
+  twist_.linear.y = twist[1];
+  twist_.linear.z = twist[2];
+  twist_.angular.x = twist[3];
+  twist_.angular.y = twist[4];
+  twist_.angular.z = twist[5];
+
+  if (!filter_initialized_)
+  {
+    filter_.reset(twist);
+    filter_initialized_ = true;
+  }
+  else
+  {
+    filter_.update(twist, period.toSec());
+  }
+
+  const AlphaBetaGammaFilter::Vector6d& accel = filter_.getAccel();
+  accel_.linear.x = accel[0];
+  accel_.linear.y = accel[1];
+  accel_.linear.z = accel[2];
+  accel_.angular.x = accel[3];
+  accel_.angular.y = accel[4];
+  accel_.angular.z = accel[5];
+
+  const AlphaBetaGammaFilter::Vector6d& jerk = filter_.getJerk();
+  jerk_.linear.x = jerk[0];
+  jerk_.linear.y = jerk[1];
+  jerk_.linear.z = jerk[2];
+  jerk_.angular.x = jerk[3];
+  jerk_.angular.y = jerk[4];
+  jerk_.angular.z = jerk[5];
+
+  state_buffer_.publish(pose_, twist_, accel_, jerk_);
+}
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_kinematics/cartesian_velocity_adapter.h>
+
+#include <hardware_interface/internal/demangle_symbol.h>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+bool claimsInterface(const std::list<hardware_interface::ControllerInfo>& controllers, const std::string& name)
+{
+  for (const hardware_interface::ControllerInfo& info : controllers)
+  {
+    for (const hardware_interface::InterfaceResources& claimed : info.claimed_resources)
+    {
+      if (claimed.hardware_interface == name)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+}  // namespace
+
+bool CartesianVelocityAdapter::init(hardware_interface::RobotHW* hw, const ros::NodeHandle& nh)
+{
+  if (!state_provider_.init(hw, nh))
+  {
+    return false;
+  }
+
+  hardware_interface::VelocityJointInterface* joint_interface = hw->get<hardware_interface::VelocityJointInterface>();
+  if (!joint_interface)
+  {
+    ROS_ERROR_STREAM("The robot provides no VelocityJointInterface.");
+    return false;
+  }
+
+  joint_handles_.clear();
+  for (const std::string& name : state_provider_.getJointNames())
+  {
+    try
+    {
+      joint_handles_.push_back(joint_interface->getHandle(name));
+    }
+    catch (const hardware_interface::HardwareInterfaceException& e)
+    {
+      ROS_ERROR_STREAM("Joint '" << name << "' of the chain is missing: " << e.what());
+      return false;
+    }
+  }
+
+  const int joints = joint_handles_.size();
+  ik_solver_.init(joints, nh.param("damping", 0.05), nh.param("singular_threshold", 0.01));
+  pose_gain_ = nh.param("pose_gain", 10.0);
+  posture_gain_ = nh.param("posture_gain", 1.0);
+  velocity_commands_.setZero(joints);
+  posture_velocities_.setZero(joints);
+  posture_positions_.setZero(joints);
+  posture_weights_.setZero(joints);
+
+  const CartesianStateHandle& state_handle = state_provider_.getHandle();
+  twist_interface_.registerHandle(TwistCommandHandle(state_handle, &twist_command_));
+  pose_interface_.registerHandle(PoseCommandHandle(state_handle, &pose_command_));
+  posture_interface_.registerHandle(PostureCommandHandle(state_handle, state_provider_.getJointNames(),
+                                                        posture_positions_.data(), posture_weights_.data()));
+  hw->registerInterface(&twist_interface_);
+  hw->registerInterface(&pose_interface_);
+  hw->registerInterface(&posture_interface_);
+
+  pose_command_ = state_handle.getPose();
+  return true;
+}
+
+void CartesianVelocityAdapter::read(const ros::Duration& period)
+{
+  state_provider_.update(period);
+}
+
+void CartesianVelocityAdapter::write()
+{
+  const geometry_msgs::Pose& pose = state_provider_.getHandle().getPose();
+
+  DampedLeastSquares::Twist twist;
+  if (pose_mode_)
+  {
+    // Proportional control of the pose error in the base frame
+    const Eigen::Quaterniond orientation(pose.orientation.w, pose.orientation.x, pose.orientation.y,
+                                         pose.orientation.z);
+    Eigen::Quaterniond target(pose_command_.orientation.w, pose_command_.orientation.x, pose_command_.orientation.y,
+                              pose_command_.orientation.z);
+    target.normalize();
+    const Eigen::AngleAxisd rotation_error(target * orientation.inverse());  // Angle in [0, pi]
+
+    twist[0] = pose_command_.position.x - pose.position.x;
+    twist[1] = pose_command_.position.y - pose.position.y;
+    twist[2] = pose_command_.position.z - pose.position.z;
+    twist.tail<3>() = rotation_error.angle() * rotation_error.axis();
+    twist *= pose_gain_;
+  }
+  else
+  {
+    twist << twist_command_.linear.x, twist_command_.linear.y, twist_command_.linear.z, twist_command_.angular.x,
+        twist_command_.angular.y, twist_command_.angular.z;
+  }
+
+  if (posture_weights_.any())
+  {
+    for (size_t i = 0; i < joint_handles_.size(); ++i)
+    {
+      posture_velocities_[i] = posture_weights_[i] * (posture_positions_[i] - joint_handles_[i].getPosition());
+    }
+    posture_velocities_ *= posture_gain_;
+    ik_solver_.solve(state_provider_.getJacobian().data, twist, posture_velocities_, velocity_commands_);
+  }
+  else
+  {
+    ik_solver_.solve(state_provider_.getJacobian().data, twist, velocity_commands_);
+  }
+  for (size_t i = 0; i < joint_handles_.size(); ++i)
+  {
+    joint_handles_[i].setCommand(velocity_commands_[i]);
+  }
+}
+
+void CartesianVelocityAdapter::doSwitch(const std::list<hardware_interface::ControllerInfo>& start_list,
+                                        const std::list<hardware_interface::ControllerInfo>& stop_list)
+{
+  const std::string pose_interface = hardware_interface::internal::demangledTypeName<PoseCommandInterface>();
+  if (claimsInterface(stop_list, pose_interface))
+  {
+    pose_mode_ = false;
+  }
+  if (claimsInterface(start_list, pose_interface))
+  {
+    // Hold still until the new controller commands something else
+    pose_command_ = state_provider_.getHandle().getPose();
+    pose_mode_ = true;
+  }
+
+  const std::string posture_interface = hardware_interface::internal::demangledTypeName<PostureCommandInterface>();
+  if (claimsInterface(stop_list, posture_interface))
+  {
+    posture_weights_.setZero();
+  }
+
+  // Stale twists from stopped controllers must not move the robot
+  twist_command_ = geometry_msgs::Twist();
+}
+
+}  // namespace cartesian_ros_control
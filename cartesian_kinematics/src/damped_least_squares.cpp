@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_kinematics/damped_least_squares.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cartesian_ros_control
+{
+void DampedLeastSquares::init(int joints, double max_damping, double singular_threshold)
+{
+  joints_ = joints;
+  max_damping_ = max_damping;
+  singular_threshold_ = singular_threshold;
+  damping_ = 0.0;
+
+  transposed_ = joints > 6;
+  workspace_.setZero(std::max(6, joints), std::min(6, joints));
+  svd_ = Eigen::JacobiSVD<Eigen::MatrixXd>(workspace_.rows(), workspace_.cols(),
+                                           Eigen::ComputeThinU | Eigen::ComputeThinV);
+  weighted_.setZero(workspace_.cols());
+  projected_.setZero(workspace_.cols());
+}
+
+void DampedLeastSquares::solve(const Jacobian& jacobian, const Twist& twist, Eigen::VectorXd& joint_velocities)
+{
+  if (transposed_)
+  {
+    workspace_ = jacobian.transpose();
+  }
+  else
+  {
+    workspace_ = jacobian;
+  }
+  svd_.compute(workspace_, Eigen::ComputeThinU | Eigen::ComputeThinV);
+
+  // Left and right singular vectors of the Jacobian
+  const Eigen::MatrixXd& u = transposed_ ? svd_.matrixV() : svd_.matrixU();
+  const Eigen::MatrixXd& v = transposed_ ? svd_.matrixU() : svd_.matrixV();
+
+  const Eigen::VectorXd& sigma = svd_.singularValues();
+  const double sigma_min = sigma[sigma.size() - 1];
+
+  // Smooth damping near singularities, see Chiaverini et al. 1994
+  damping_ = 0.0;
+  if (sigma_min < singular_threshold_)
+  {
+    const double ratio = sigma_min / singular_threshold_;
+    damping_ = max_damping_ * std::sqrt(1.0 - ratio * ratio);
+  }
+  const double damping2 = damping_ * damping_;
+
+  weighted_.noalias() = u.transpose() * twist;
+  for (int i = 0; i < weighted_.size(); ++i)
+  {
+    const double s = sigma[i];
+    const double denominator = s * s + damping2;
+    weighted_[i] *= (denominator > 0.0) ? s / denominator : 0.0;
+  }
+  joint_velocities.noalias() = v * weighted_;
+}
+
+void DampedLeastSquares::solve(const Jacobian& jacobian, const Twist& twist, const Eigen::VectorXd& secondary,
+                               Eigen::VectorXd& joint_velocities)
+{
+  solve(jacobian, twist, joint_velocities);
+
+  // J^+ J = V * diag(s^2 / (s^2 + lambda^2)) * V^T
+  const Eigen::MatrixXd& v = transposed_ ? svd_.matrixU() : svd_.matrixV();
+  const Eigen::VectorXd& sigma = svd_.singularValues();
+  const double damping2 = damping_ * damping_;
+
+  projected_.noalias() = v.transpose() * secondary;
+  for (int i = 0; i < projected_.size(); ++i)
+  {
+    const double s2 = sigma[i] * sigma[i];
+    const double denominator = s2 + damping2;
+    projected_[i] *= (denominator > 0.0) ? s2 / denominator : 0.0;
+  }
+  joint_velocities += secondary;
+  joint_velocities.noalias() -= v * projected_;
+}
+
+}  // namespace cartesian_ros_control
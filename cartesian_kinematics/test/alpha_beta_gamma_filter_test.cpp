@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cartesian_kinematics/alpha_beta_gamma_filter.h>
+
+using namespace cartesian_ros_control;
+
+typedef AlphaBetaGammaFilter::Vector6d Vector6d;
+
+TEST(AlphaBetaGammaFilterTest, TestConstantJerk)
+{
+  AlphaBetaGammaFilter filter;
+  const double period = 0.001;
+  const Vector6d jerk = Vector6d::LinSpaced(-3.0, 3.0);
+
+  // Twist under constant jerk from rest: v = j * t^2 / 2
+  double t = 0.0;
+  for (int i = 0; i < 5000; ++i)
+  {
+    t += period;
+    filter.update(0.5 * jerk * t * t, period);
+  }
+
+  EXPECT_TRUE(filter.getTwist().isApprox(0.5 * jerk * t * t, 1e-6));
+  EXPECT_TRUE(filter.getAccel().isApprox(jerk * t, 1e-4));
+  EXPECT_TRUE(filter.getJerk().isApprox(jerk, 1e-3));
+}
+
+TEST(AlphaBetaGammaFilterTest, TestReset)
+{
+  AlphaBetaGammaFilter filter;
+  filter.update(Vector6d::Ones(), 0.01);
+  filter.reset(Vector6d::Constant(2.0));
+
+  EXPECT_TRUE(filter.getTwist().isApprox(Vector6d::Constant(2.0)));
+  EXPECT_TRUE(filter.getAccel().isZero());
+  EXPECT_TRUE(filter.getJerk().isZero());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cartesian_kinematics/damped_least_squares.h>
+
+using namespace cartesian_ros_control;
+
+// The test target compiles the solver with EIGEN_RUNTIME_NO_MALLOC, so any
+// heap allocation between the set_is_malloc_allowed() calls fails the test.
+
+TEST(DampedLeastSquaresTest, TestExactAwayFromSingularities)
+{
+  DampedLeastSquares solver;
+  solver.init(7, 0.1, 0.01);
+
+  DampedLeastSquares::Jacobian jacobian = DampedLeastSquares::Jacobian::Random(6, 7);
+  DampedLeastSquares::Twist twist;
+  twist << 0.1, -0.2, 0.3, 0.01, -0.02, 0.03;
+  Eigen::VectorXd q_dot(7);
+
+  Eigen::internal::set_is_malloc_allowed(false);
+  solver.solve(jacobian, twist, q_dot);
+  Eigen::internal::set_is_malloc_allowed(true);
+
+  EXPECT_DOUBLE_EQ(0.0, solver.getDamping());
+  EXPECT_TRUE((jacobian * q_dot).isApprox(twist, 1e-9));
+
+  // The minimum-norm solution has no null space component
+  Eigen::VectorXd expected = jacobian.completeOrthogonalDecomposition().solve(twist);
+  EXPECT_TRUE(q_dot.isApprox(expected, 1e-9));
+}
+
+TEST(DampedLeastSquaresTest, TestLeastSquaresForShortChains)
+{
+  DampedLeastSquares solver;
+  solver.init(5, 0.1, 0.01);
+
+  DampedLeastSquares::Jacobian jacobian = DampedLeastSquares::Jacobian::Random(6, 5);
+  DampedLeastSquares::Twist twist = DampedLeastSquares::Twist::Random();
+  Eigen::VectorXd q_dot(5);
+
+  Eigen::internal::set_is_malloc_allowed(false);
+  solver.solve(jacobian, twist, q_dot);
+  Eigen::internal::set_is_malloc_allowed(true);
+
+  Eigen::VectorXd expected = jacobian.colPivHouseholderQr().solve(twist);
+  EXPECT_TRUE(q_dot.isApprox(expected, 1e-9));
+}
+
+TEST(DampedLeastSquaresTest, TestBoundedAtSingularities)
+{
+  DampedLeastSquares solver;
+  solver.init(6, 0.1, 0.05);
+
+  // Two identical columns: Singular in one direction
+  DampedLeastSquares::Jacobian jacobian = DampedLeastSquares::Jacobian::Identity(6, 6);
+  jacobian.col(5) = jacobian.col(4);
+  DampedLeastSquares::Twist twist = DampedLeastSquares::Twist::Ones();
+  Eigen::VectorXd q_dot(6);
+
+  Eigen::internal::set_is_malloc_allowed(false);
+  solver.solve(jacobian, twist, q_dot);
+  Eigen::internal::set_is_malloc_allowed(true);
+
+  EXPECT_DOUBLE_EQ(0.1, solver.getDamping());
+  EXPECT_TRUE(q_dot.allFinite());
+  EXPECT_LT(q_dot.norm(), 10.0);
+}
+
+TEST(DampedLeastSquaresTest, TestSecondaryTaskInNullSpace)
+{
+  DampedLeastSquares solver;
+  solver.init(7, 0.1, 0.01);
+
+  DampedLeastSquares::Jacobian jacobian = DampedLeastSquares::Jacobian::Random(6, 7);
+  DampedLeastSquares::Twist twist = DampedLeastSquares::Twist::Random();
+  Eigen::VectorXd secondary = Eigen::VectorXd::Random(7);
+  Eigen::VectorXd primary(7);
+  Eigen::VectorXd q_dot(7);
+  solver.solve(jacobian, twist, primary);
+
+  Eigen::internal::set_is_malloc_allowed(false);
+  solver.solve(jacobian, twist, secondary, q_dot);
+  Eigen::internal::set_is_malloc_allowed(true);
+
+  // The Cartesian motion is unaffected, but the posture changes
+  EXPECT_TRUE((jacobian * q_dot).isApprox(twist, 1e-9));
+  const Eigen::VectorXd null_motion = q_dot - primary;
+  EXPECT_GT(null_motion.norm(), 1e-6);
+  EXPECT_LT((jacobian * null_motion).norm(), 1e-9);
+
+  // It is the best approximation of the secondary task within the null space
+  EXPECT_NEAR(0.0, null_motion.dot(secondary - null_motion), 1e-9);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <unistd.h>
+
+#include <cartesian_flight_recorder/flight_recorder.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+/**
+ * @brief Recording one cycle of a twist command handle, as a controller's update() would
+ *
+ * The background thread drains concurrently, so this includes the cost of
+ * sharing the queue's cache lines with it.
+ */
+void BM_FlightRecorderRecord(benchmark::State& state)
+{
+  geometry_msgs::Pose pose;
+  geometry_msgs::Twist twist;
+  geometry_msgs::Accel accel;
+  geometry_msgs::Accel jerk;
+  geometry_msgs::Twist command;
+  pose.orientation.w = 1.0;
+  TwistCommandHandle handle(CartesianStateHandle("base", "tool0", &pose, &twist, &accel, &jerk), &command);
+
+  FlightRecorderSettings settings;
+  settings.path = "/tmp/cartesian_ros_control_benchmark_" + std::to_string(getpid()) + ".bin";
+  settings.records = 100000;
+  settings.queue_size = 1 << 16;
+  FlightRecorder recorder;
+  std::string error;
+  if (!recorder.open(settings, error))
+  {
+    state.SkipWithError(error.c_str());
+    return;
+  }
+
+  ros::Time time(1.0);
+  const ros::Duration period(0.001);
+  for (auto _ : state)
+  {
+    recorder.record(time, handle);
+    time += period;
+  }
+  recorder.close();
+  unlink(settings.path.c_str());
+}
+BENCHMARK(BM_FlightRecorderRecord);
+}  // namespace
@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <string>
+
+#include <cartesian_interface/cartesian_command_interface.h>
+#include <cartesian_interface/cartesian_state_handle.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+/**
+ * @brief Raw buffers for a number of frames, as a RobotHW would hold them
+ */
+struct Buffers
+{
+  std::deque<geometry_msgs::Pose> poses;
+  std::deque<geometry_msgs::Twist> twists;
+  std::deque<geometry_msgs::Accel> accels;
+  std::deque<geometry_msgs::Accel> jerks;
+
+  explicit Buffers(size_t frames)
+    : poses(frames)
+    , twists(frames)
+    , accels(frames)
+    , jerks(frames)
+  {
+  }
+};
+
+std::string frameName(size_t i)
+{
+  return "frame_" + std::to_string(i);
+}
+
+/**
+ * @brief Cost of looking up one of state.range(0) registered frames
+ */
+void BM_StateInterfaceGetHandle(benchmark::State& state)
+{
+  const size_t frames = state.range(0);
+  Buffers buffers(frames);
+  CartesianStateInterface iface;
+  for (size_t i = 0; i < frames; ++i)
+  {
+    iface.registerHandle(CartesianStateHandle("base", frameName(i), &buffers.poses[i], &buffers.twists[i],
+                                              &buffers.accels[i], &buffers.jerks[i]));
+  }
+
+  const std::string name = frameName(frames / 2);
+  for (auto _ : state)
+  {
+    CartesianStateHandle handle = iface.getHandle(name);
+    benchmark::DoNotOptimize(handle);
+  }
+}
+BENCHMARK(BM_StateInterfaceGetHandle)->RangeMultiplier(10)->Range(1, 1000);
+
+/**
+ * @brief Same through the interned frame id
+ */
+void BM_StateInterfaceGetHandleById(benchmark::State& state)
+{
+  const size_t frames = state.range(0);
+  Buffers buffers(frames);
+  CartesianStateInterface iface;
+  for (size_t i = 0; i < frames; ++i)
+  {
+    iface.registerHandle(CartesianStateHandle("base", frameName(i), &buffers.poses[i], &buffers.twists[i],
+                                              &buffers.accels[i], &buffers.jerks[i]));
+  }
+
+  const FrameId frame_id(frameName(frames / 2));
+  for (auto _ : state)
+  {
+    CartesianStateHandle handle = iface.getHandle(frame_id);
+    benchmark::DoNotOptimize(handle);
+  }
+}
+BENCHMARK(BM_StateInterfaceGetHandleById)->RangeMultiplier(10)->Range(1, 1000);
+
+/**
+ * @brief Same with resource claiming, as controllers do in init()
+ */
+void BM_PoseCommandInterfaceGetHandle(benchmark::State& state)
+{
+  const size_t frames = state.range(0);
+  Buffers buffers(frames);
+  std::deque<geometry_msgs::Pose> commands(frames);
+  PoseCommandInterface iface;
+  for (size_t i = 0; i < frames; ++i)
+  {
+    iface.registerHandle(PoseCommandHandle(CartesianStateHandle("base", frameName(i), &buffers.poses[i],
+                                                                &buffers.twists[i], &buffers.accels[i],
+                                                                &buffers.jerks[i]),
+                                           &commands[i]));
+  }
+
+  const std::string name = frameName(frames / 2);
+  for (auto _ : state)
+  {
+    PoseCommandHandle handle = iface.getHandle(name);
+    benchmark::DoNotOptimize(handle);
+  }
+}
+BENCHMARK(BM_PoseCommandInterfaceGetHandle)->RangeMultiplier(10)->Range(1, 1000);
+
+class StateHandleFixture : public benchmark::Fixture
+{
+public:
+  StateHandleFixture()
+    : buffers(1)
+    , handle("base", "tool0", &buffers.poses[0], &buffers.twists[0], &buffers.accels[0], &buffers.jerks[0])
+  {
+  }
+
+  Buffers buffers;
+  CartesianStateHandle handle;
+};
+
+BENCHMARK_F(StateHandleFixture, GetPose)(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    geometry_msgs::Pose pose = handle.getPose();
+    benchmark::DoNotOptimize(pose);
+  }
+}
+
+BENCHMARK_F(StateHandleFixture, GetTwist)(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    geometry_msgs::Twist twist = handle.getTwist();
+    benchmark::DoNotOptimize(twist);
+  }
+}
+
+BENCHMARK_F(StateHandleFixture, GetAccel)(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    geometry_msgs::Accel accel = handle.getAccel();
+    benchmark::DoNotOptimize(accel);
+  }
+}
+
+BENCHMARK_F(StateHandleFixture, GetJerk)(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    geometry_msgs::Accel jerk = handle.getJerk();
+    benchmark::DoNotOptimize(jerk);
+  }
+}
+
+BENCHMARK_F(StateHandleFixture, GetState)(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    CartesianState snapshot = handle.getState();
+    benchmark::DoNotOptimize(snapshot);
+  }
+}
+
+BENCHMARK_F(StateHandleFixture, GetStateFromBuffer)(benchmark::State& state)
+{
+  CartesianStateBuffer state_buffer;
+  CartesianStateHandle buffered("base", "tool0", &buffers.poses[0], &buffers.twists[0], &buffers.accels[0],
+                                &buffers.jerks[0], &state_buffer);
+  for (auto _ : state)
+  {
+    CartesianState snapshot = buffered.getState();
+    benchmark::DoNotOptimize(snapshot);
+  }
+}
+
+BENCHMARK_F(StateHandleFixture, GetPositionMap)(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    Eigen::Vector3d position = handle.getPositionMap();
+    benchmark::DoNotOptimize(position);
+  }
+}
+}  // namespace
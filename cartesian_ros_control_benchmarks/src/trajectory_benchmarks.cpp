@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <cartesian_trajectory_controller/cartesian_time_parametrization.h>
+#include <cartesian_trajectory_controller/tolerance_checker.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+/**
+ * @brief Per-cycle tolerance check with all 18 components limited and within tolerance
+ */
+void BM_ToleranceCheck(benchmark::State& state)
+{
+  cartesian_control_msgs::CartesianTolerance tolerance;
+  tolerance.position_error.x = tolerance.position_error.y = tolerance.position_error.z = 0.01;
+  tolerance.orientation_error.x = tolerance.orientation_error.y = tolerance.orientation_error.z = 0.1;
+  tolerance.twist_error.linear.x = tolerance.twist_error.linear.y = tolerance.twist_error.linear.z = 0.1;
+  tolerance.twist_error.angular.x = tolerance.twist_error.angular.y = tolerance.twist_error.angular.z = 0.1;
+  tolerance.acceleration_error.linear.x = tolerance.acceleration_error.linear.y = 1.0;
+  tolerance.acceleration_error.linear.z = tolerance.acceleration_error.angular.x = 1.0;
+  tolerance.acceleration_error.angular.y = tolerance.acceleration_error.angular.z = 1.0;
+  ToleranceChecker checker(tolerance);
+
+  CartesianState desired;
+  desired.pose.orientation.w = 1.0;
+  CartesianState actual = desired;
+  actual.pose.position.x = 0.001;
+  actual.pose.orientation.z = 0.01;
+  actual.pose.orientation.w = 0.99995;
+  actual.twist.linear.y = 0.01;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(checker.check(desired, actual));
+  }
+}
+BENCHMARK(BM_ToleranceCheck);
+
+/**
+ * @brief Retiming a curved path of state.range(0) waypoints, with and without jerk limits
+ */
+void BM_TimeParametrization(benchmark::State& state)
+{
+  cartesian_control_msgs::CartesianTrajectory path;
+  path.points.resize(state.range(0));
+  for (size_t i = 0; i < path.points.size(); ++i)
+  {
+    geometry_msgs::Pose& pose = path.points[i].pose;
+    pose.position.x = 0.3 * std::sin(i * 0.001);
+    pose.position.y = 0.2 * std::cos(i * 0.002);
+    pose.position.z = 0.001 * i;
+    pose.orientation.x = std::sin(i * 5e-5);
+    pose.orientation.w = std::cos(i * 5e-5);
+  }
+
+  CartesianTimeParametrization retimer;
+  std::string error;
+  const CartesianTimeParametrization::Vector6d jerk =
+      CartesianTimeParametrization::Vector6d::Constant(state.range(1) ? 10.0 : 0.0);
+  if (!retimer.setLimits(CartesianTimeParametrization::Vector6d::Constant(0.5),
+                         CartesianTimeParametrization::Vector6d::Constant(2.0), jerk, error))
+  {
+    state.SkipWithError(error.c_str());
+    return;
+  }
+
+  for (auto _ : state)
+  {
+    cartesian_control_msgs::CartesianTrajectory trajectory = path;
+    if (!retimer.retime(trajectory, error))
+    {
+      state.SkipWithError(error.c_str());
+      break;
+    }
+    benchmark::DoNotOptimize(trajectory.points.back().time_from_start);
+  }
+}
+BENCHMARK(BM_TimeParametrization)
+    ->Args({ 1000, 0 })
+    ->Args({ 10000, 0 })
+    ->Args({ 10000, 1 })
+    ->Unit(benchmark::kMillisecond);
+}  // namespace
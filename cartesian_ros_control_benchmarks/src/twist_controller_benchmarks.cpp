@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <twist_controller/twist_controller.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+/**
+ * @brief Exposes the subscriber callbacks without a running ROS node
+ */
+class BenchmarkTwistController : public TwistController
+{
+public:
+  using TwistController::twistCallback;
+  using TwistController::twistStampedCallback;
+};
+
+class TwistControllerFixture : public benchmark::Fixture
+{
+public:
+  void SetUp(const benchmark::State& /*state*/) override
+  {
+    pose.orientation.w = 1.0;
+    controller.handle_ = TwistCommandHandle(CartesianStateHandle("base", "tool0", &pose, &twist, &accel, &jerk),
+                                            &command);
+    controller.starting(ros::Time::now());
+    msg.reset(new geometry_msgs::Twist());
+    msg->linear.x = 0.1;
+    msg->angular.z = -0.2;
+  }
+
+  geometry_msgs::Pose pose;
+  geometry_msgs::Twist twist;
+  geometry_msgs::Accel accel;
+  geometry_msgs::Accel jerk;
+  geometry_msgs::Twist command;
+  BenchmarkTwistController controller;
+  geometry_msgs::TwistPtr msg;
+};
+
+BENCHMARK_F(TwistControllerFixture, Update)(benchmark::State& state)
+{
+  controller.twistCallback(msg);
+  const ros::Duration period(0.001);
+  ros::Time time = ros::Time::now();
+  for (auto _ : state)
+  {
+    controller.update(time, period);
+    benchmark::DoNotOptimize(command);
+  }
+}
+
+BENCHMARK_F(TwistControllerFixture, UpdateInToolFrame)(benchmark::State& state)
+{
+  geometry_msgs::TwistStampedPtr stamped(new geometry_msgs::TwistStamped());
+  stamped->header.frame_id = "tool0";
+  stamped->header.stamp = ros::Time::now();
+  stamped->twist = *msg;
+  controller.twistStampedCallback(stamped);
+
+  const ros::Duration period(0.001);
+  ros::Time time = ros::Time::now();
+  for (auto _ : state)
+  {
+    controller.update(time, period);
+    benchmark::DoNotOptimize(command);
+  }
+}
+
+BENCHMARK_F(TwistControllerFixture, TwistCallback)(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    controller.twistCallback(msg);
+  }
+}
+
+BENCHMARK_F(TwistControllerFixture, SetCommand)(benchmark::State& state)
+{
+  Vector6d twist;
+  twist << 0.1, 0.0, 0.0, 0.0, 0.0, -0.2;
+  for (auto _ : state)
+  {
+    controller.setCommand(twist);
+  }
+}
+
+/**
+ * @brief Writing and reading one sample through shared memory, as a producer and update() would
+ */
+void BM_SharedMemoryIngress(benchmark::State& state)
+{
+  SharedMemorySlot<SharedTwistCommand> reader;
+  SharedMemorySlot<SharedTwistCommand> writer;
+  std::string error;
+  if (!reader.open("/cartesian_ros_control_benchmark", true, error) ||
+      !writer.open("/cartesian_ros_control_benchmark", false, error))
+  {
+    state.SkipWithError(error.c_str());
+    return;
+  }
+
+  SharedTwistCommand command = {};
+  command.twist[0] = 0.1;
+  for (auto _ : state)
+  {
+    writer.write(command);
+    benchmark::DoNotOptimize(reader.read(command));
+  }
+}
+BENCHMARK(BM_SharedMemoryIngress);
+}  // namespace
@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <cartesian_control_msgs/CartesianTrajectory.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Time-optimal retiming of Cartesian paths under per-axis limits
+ *
+ * Fills time_from_start, twist, acceleration and jerk of a
+ * CartesianTrajectory's waypoints so that the path is traversed as fast as
+ * the limits allow, starting and ending at rest. Axes are ordered linear x,
+ * y, z followed by angular x, y, z, all in the trajectory's reference
+ * frame. A limit of zero leaves the axis unlimited in that derivative.
+ *
+ * The waypoints serve as the grid of a reachability analysis in the style
+ * of TOPP-RA (Pham and Pham, 2018). The path parameter s advances by one
+ * from grid point to grid point, with tangents and curvatures from finite
+ * differences. Paths with few waypoints are subdivided evenly, so that the
+ * grid always has a few hundred intervals. Velocity and acceleration
+ * limits are linear constraints in the squared path velocity
+ * x = (ds/dt)^2 and the path acceleration u. A backward pass computes the
+ * largest x at each grid point from which the robot can still stop at the
+ * end, and a forward pass then accelerates greedily within that bound.
+ * Both passes are linear in the number of grid points.
+ *
+ * Jerk is beyond this second-order formulation. It is limited afterwards
+ * by averaging the path position of the time-optimal profile over a
+ * sliding time window, which turns the steps of the bang-bang path
+ * acceleration into ramps and adds exactly the window to the duration. The
+ * window starts with the time needed to build up the largest acceleration
+ * within the jerk limits. Straight lines that reach the acceleration limit
+ * thus get the time-optimal S-curve. The window grows while that reduces
+ * the jerk, and whatever violation remains, e.g. from the path's
+ * curvature, is removed by slowing down uniformly.
+ *
+ * This is meant for non-real-time use, e.g. by planners before sending a
+ * goal. The first waypoint should be the robot's current pose.
+ */
+class CartesianTimeParametrization
+{
+public:
+  typedef Eigen::Matrix<double, 6, 1> Vector6d;
+
+  CartesianTimeParametrization() = default;
+
+  /**
+   * @brief Set the per-axis limits
+   *
+   * @return False if the limits are negative or neither velocity nor acceleration is limited
+   */
+  bool setLimits(const Vector6d& velocity, const Vector6d& acceleration, const Vector6d& jerk, std::string& error);
+
+  /**
+   * @brief Retime \a trajectory in place
+   *
+   * Only the waypoints' poses are read. Everything else of the waypoints is
+   * overwritten.
+   *
+   * @param trajectory A path with at least two waypoints
+   * @param error Human readable reason if \a trajectory can't be retimed
+   *
+   * @return True on success
+   */
+  bool retime(cartesian_control_msgs::CartesianTrajectory& trajectory, std::string& error);
+
+private:
+  typedef Eigen::Matrix<double, 6, Eigen::Dynamic> Matrix6Xd;
+
+  void accelerationBounds(size_t i, double x, double& lower, double& upper) const;
+  bool isFeasible(size_t i, double x, double x_next) const;
+  double maxFeasible(size_t i, double x_next) const;
+  void computeProfile();
+  bool integrate(std::string& error);
+  void limitRatios(double& velocity, double& acceleration, double& jerk) const;
+  bool limitJerk(std::string& error);
+  void sampleProfile(double t, double& area, double& s, double& v) const;
+  bool smooth(double ramp, std::string& error);
+
+  Vector6d max_velocity_ = { Vector6d::Zero() };
+  Vector6d max_acceleration_ = { Vector6d::Zero() };
+  Vector6d max_jerk_ = { Vector6d::Zero() };
+
+  // Workspaces, one column or element per grid point
+  Matrix6Xd tangents_;
+  Matrix6Xd curvatures_;
+  Matrix6Xd accelerations_;
+  std::vector<double> velocity_bounds_;  ///< Upper bounds on x from velocity limits
+  std::vector<double> controllable_;     ///< Largest x from which we can still stop
+  std::vector<double> x_;
+  std::vector<double> u_;
+  std::vector<double> times_;
+  std::vector<double> profile_times_;  ///< Time-optimal times, x and u before smoothing
+  std::vector<double> profile_x_;
+  std::vector<double> profile_u_;
+  std::vector<double> areas_;  ///< Integral of s over time up to each grid point
+};
+
+}  // namespace cartesian_ros_control
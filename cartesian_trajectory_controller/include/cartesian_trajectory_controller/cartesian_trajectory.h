@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Geometry>
+#include <Eigen/StdVector>
+
+#include <cartesian_control_msgs/CartesianTrajectory.h>
+#include <cartesian_interface/cartesian_state_buffer.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A Cartesian trajectory that can be sampled in real-time
+ *
+ * The trajectory is built once from a cartesian_control_msgs::CartesianTrajectory
+ * in a non-real-time context. This converts the waypoints into a contiguous
+ * array of spline segments. Sampling afterwards neither allocates nor
+ * touches the original message.
+ *
+ * Each segment interpolates the position with quintic polynomials that
+ * match pose, twist and acceleration of both waypoints. The orientation is
+ * interpolated the same way in the rotation vector relative to the
+ * segment's start orientation. Between waypoints at rest, this is a SLERP
+ * with quintic timing.
+ *
+ * Sampling remembers the last segment, so that the cost per cycle is
+ * constant and independent of the trajectory's length.
+ */
+class CartesianTrajectory
+{
+public:
+  CartesianTrajectory() = default;
+
+  /**
+   * @brief Build the trajectory from a trajectory message
+   *
+   * If the first waypoint has a positive time_from_start, the trajectory
+   * starts in \a start_state at time zero.
+   *
+   * @param msg The trajectory message. Waypoints must be given in the reference frame of the controlled handle.
+   * @param start_state The state to start from
+   * @param error Human readable reason if the message is rejected
+   *
+   * @return True if \a msg describes a valid trajectory
+   */
+  bool init(const cartesian_control_msgs::CartesianTrajectory& msg, const CartesianState& start_state,
+            std::string& error);
+
+  /**
+   * @brief Sample the trajectory at \a time seconds from its start
+   *
+   * Times before the start or after the end yield the first or the last
+   * waypoint at rest.
+   */
+  void sample(double time, CartesianState& state);
+
+  /**
+   * @brief Time in seconds from the start to the last waypoint
+   */
+  double getDuration() const;
+
+  bool empty() const
+  {
+    return segments_.empty();
+  }
+
+private:
+  typedef Eigen::Matrix<double, 3, 6> QuinticCoefficients;
+
+  struct Segment
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    double start_time;
+    double duration;
+    Eigen::Quaterniond start_orientation;
+    QuinticCoefficients position;
+    QuinticCoefficients rotation;  ///< Rotation vector relative to start_orientation
+  };
+
+  size_t findSegment(double time);
+
+  std::vector<Segment, Eigen::aligned_allocator<Segment>> segments_;
+  size_t cursor_ = { 0 };
+};
+
+}  // namespace cartesian_ros_control
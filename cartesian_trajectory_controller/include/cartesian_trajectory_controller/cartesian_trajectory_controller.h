@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <actionlib/server/action_server.h>
+#include <cartesian_control_msgs/FollowCartesianTrajectoryAction.h>
+#include <controller_interface/multi_interface_controller.h>
+#include <realtime_tools/realtime_buffer.h>
+#include <realtime_tools/realtime_server_goal_handle.h>
+
+#include <cartesian_interface/cartesian_command_interface.h>
+#include <cartesian_interface/spsc_queue.h>
+#include <cartesian_interface/triple_buffer.h>
+#include <cartesian_trajectory_controller/cartesian_trajectory.h>
+#include <cartesian_trajectory_controller/tolerance_checker.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A Cartesian ROS-controller for executing FollowCartesianTrajectory goals
+ *
+ * Goals are checked and converted into a CartesianTrajectory when they
+ * arrive. The real-time update() only samples the active trajectory,
+ * writes the setpoint to the hardware and monitors the
+ * path_tolerance, goal_tolerance and goal_time_tolerance of the goal.
+ * Tolerances are packed into a ToleranceChecker on arrival. Violations
+ * name the first violated component in the result's error_string.
+ *
+ * The controller writes pose, twist and acceleration through a
+ * PoseTwistAccelCommandInterface if the robot provides one. Otherwise, it
+ * falls back to pose commands through a PoseCommandInterface.
+ *
+ * With the \a streaming parameter set, goals that arrive while another
+ * goal is active do not preempt it. They are appended to its tail instead:
+ * their time_from_start counts from the last waypoint of the previous goal,
+ * so it must be positive, and the real-time loop continues with them
+ * seamlessly. Each appended goal still reports its own result. Up to
+ * \a stream_capacity goals can wait in a lock-free queue, so long paths can
+ * be streamed in chunks with bounded memory. If the stream runs dry, the robot stops at the last waypoint and
+ * continues once the next chunk arrives.
+ *
+ * If the robot also provides a PostureCommandInterface for the controlled
+ * frame, the posture of each waypoint is passed on to the hardware while
+ * the robot moves towards that waypoint. Redundant robots use it to stay
+ * clear of joint limits. Posture joint names are resolved to the handle's
+ * joint indices once, when the goal arrives. Goals with unknown posture
+ * joints are rejected.
+ *
+ * Action feedback is sent at \a feedback_rate (zero disables it),
+ * independent of the control rate. Each goal preallocates its feedback
+ * messages in a TripleBuffer when it arrives. update() fills them in place
+ * at that rate and a timer publishes the latest one from a non-real-time
+ * thread.
+ */
+class CartesianTrajectoryController
+  : public controller_interface::MultiInterfaceController<PoseCommandInterface, PoseTwistAccelCommandInterface,
+                                                          PostureCommandInterface>
+{
+public:
+  CartesianTrajectoryController();
+  virtual ~CartesianTrajectoryController() = default;
+
+  virtual bool init(hardware_interface::RobotHW* hw, ros::NodeHandle& root_nh,
+                    ros::NodeHandle& controller_nh) override;
+
+  virtual void starting(const ros::Time& time) override;
+
+  virtual void stopping(const ros::Time& time) override;
+
+  virtual void update(const ros::Time& time, const ros::Duration& period) override;
+
+private:
+  typedef cartesian_control_msgs::FollowCartesianTrajectoryAction Action;
+  typedef cartesian_control_msgs::FollowCartesianTrajectoryResult Result;
+  typedef cartesian_control_msgs::FollowCartesianTrajectoryFeedback Feedback;
+  typedef actionlib::ActionServer<Action> ActionServer;
+  typedef ActionServer::GoalHandle GoalHandle;
+  typedef realtime_tools::RealtimeServerGoalHandle<Action> RealtimeGoalHandle;
+  typedef boost::shared_ptr<RealtimeGoalHandle> RealtimeGoalHandlePtr;
+
+  /**
+   * @brief Joint postures of a goal's waypoints, resolved to posture handle indices
+   *
+   * Entries of waypoint i are indices[offsets[i]] to indices[offsets[i + 1] - 1]
+   * with the according values.
+   */
+  struct PostureSchedule
+  {
+    std::vector<double> times;  ///< time_from_start of each waypoint
+    std::vector<size_t> offsets;
+    std::vector<size_t> indices;
+    std::vector<double> values;
+  };
+
+  /**
+   * @brief Everything the real-time loop needs for executing one goal
+   */
+  struct TrajectoryGoal
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    RealtimeGoalHandlePtr goal_handle;
+    CartesianTrajectory trajectory;
+    ToleranceChecker path_tolerance;
+    ToleranceChecker goal_tolerance;
+    ros::Duration goal_time_tolerance;
+    PostureSchedule posture;  ///< Empty if the goal has no postures
+    TripleBuffer<Feedback> feedback;
+    ros::Time start_time;  ///< Zero for starting with the next update
+    uint64_t stream_id;    ///< Goals appended to each other share the same id
+  };
+  typedef std::shared_ptr<TrajectoryGoal> TrajectoryGoalPtr;
+
+  void goalCallback(GoalHandle gh);
+  void cancelCallback(GoalHandle gh);
+  void goalHandleTimerCallback(const ros::TimerEvent& event);
+  void feedbackTimerCallback(const ros::TimerEvent& event);
+  void preemptActiveGoal(const std::string& reason);
+  void cancelStoppedGoals();  ///< Cancels all goals after stopping() was called
+  void releaseRetiredGoals();
+
+  void switchGoal(TrajectoryGoal* goal, bool from_stream, const ros::Time& start_time);
+  TrajectoryGoal* popStreamedGoal();
+  void abortStream(int32_t error_code, const char* reason, int component);  ///< Aborts rt_goal_ and its appended goals
+  void writeCommand(const CartesianState& setpoint);
+  void holdPose(const geometry_msgs::Pose& pose);
+  bool resolvePosture(const cartesian_control_msgs::CartesianTrajectory& trajectory, PostureSchedule& posture,
+                      std::string& error) const;
+  void writePosture(double time);
+  void writeFeedback(const ros::Time& time, double trajectory_time, const CartesianState& actual);
+
+  ros::NodeHandle controller_nh_;
+  std::unique_ptr<ActionServer> action_server_;
+  ros::Timer goal_handle_timer_;
+  ros::Duration action_monitor_period_;
+  ros::Timer feedback_timer_;
+  ros::Duration feedback_period_;  ///< Zero disables feedback
+
+  bool has_feedforward_ = { false };
+  CartesianStateHandle state_handle_;
+  PoseCommandHandle pose_handle_;
+  PoseTwistAccelCommandHandle feedforward_handle_;
+  bool has_posture_ = { false };
+  PostureCommandHandle posture_handle_;
+
+  bool streaming_ = { false };
+
+  // Owned by the non-real-time callbacks
+  std::mutex goal_mutex_;
+  RealtimeGoalHandlePtr active_goal_;
+  std::vector<TrajectoryGoalPtr> monitored_goals_;
+  std::deque<TrajectoryGoalPtr> streamed_goals_;  ///< Appended goals the real-time loop may still use
+  uint64_t stream_id_ = { 0 };
+  CartesianState stream_tail_;
+
+  // Shared between both sides
+  realtime_tools::RealtimeBuffer<TrajectoryGoalPtr> goal_buffer_;
+  SpscQueue<TrajectoryGoal*> stream_queue_;
+  SpscQueue<const TrajectoryGoal*> retired_goals_;  ///< Appended goals the real-time loop is done with
+  std::atomic<uint64_t> canceled_stream_ = { 0 };
+  std::atomic<bool> stop_requested_ = { false };  ///< Set by stopping(). Goals are canceled outside the real-time loop.
+
+  // Owned by the real-time loop
+  const TrajectoryGoal* rt_buffered_goal_ = { nullptr };
+  TrajectoryGoal* rt_goal_ = { nullptr };
+  bool rt_goal_from_stream_ = { false };
+  bool rt_goal_done_ = { false };
+  size_t rt_posture_waypoint_ = { 0 };  ///< Waypoint whose posture is commanded. Past the end for none.
+  uint64_t rt_aborted_stream_ = { 0 };
+  int32_t rt_aborted_error_code_ = { 0 };  ///< Reported for the appended goals of the aborted stream, too
+  const char* rt_aborted_reason_ = { "" };
+  int rt_aborted_component_ = { 0 };
+  ros::Time rt_start_time_;
+  ros::Time rt_last_feedback_;
+  CartesianState desired_;
+  CartesianState hold_;
+};
+
+}  // namespace cartesian_ros_control
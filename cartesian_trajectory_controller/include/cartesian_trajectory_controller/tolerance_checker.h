@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+
+#include <cartesian_control_msgs/CartesianTolerance.h>
+#include <cartesian_interface/cartesian_state_buffer.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Checks Cartesian states against a CartesianTolerance in real-time
+ *
+ * The tolerance message is packed into one fixed-size array of 18 limits
+ * when a goal arrives: position, orientation, linear and angular twist and
+ * linear and angular acceleration, each in x, y and z. Zero tolerances are
+ * not checked and become infinite limits.
+ *
+ * check() gathers all errors into a second array of the same layout and
+ * compares both in a single vectorized pass without per-component
+ * branches. Only if a limit is exceeded, it searches for the first violated
+ * component, which getComponentName() turns into a human readable reason.
+ */
+class ToleranceChecker
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  enum Component
+  {
+    POSITION_X = 0,
+    ORIENTATION_X = 3,
+    TWIST_LINEAR_X = 6,
+    TWIST_ANGULAR_X = 9,
+    ACCEL_LINEAR_X = 12,
+    ACCEL_ANGULAR_X = 15,
+    NUM_COMPONENTS = 18
+  };
+
+  typedef Eigen::Array<double, NUM_COMPONENTS, 1> Components;
+
+  /**
+   * @brief A checker without limits
+   */
+  ToleranceChecker();
+
+  explicit ToleranceChecker(const cartesian_control_msgs::CartesianTolerance& tolerance)
+  {
+    init(tolerance);
+  }
+
+  void init(const cartesian_control_msgs::CartesianTolerance& tolerance);
+
+  /**
+   * @brief Check \a actual against \a desired
+   *
+   * Orientation errors are the rotation vector from the actual to the
+   * desired orientation. All errors are given in the reference frame.
+   *
+   * A non-finite error violates its component unless that is unchecked.
+   *
+   * @return The first violated Component or -1 if all errors are within tolerance
+   */
+  int check(const CartesianState& desired, const CartesianState& actual);
+
+  /**
+   * @brief Errors of the last check()
+   */
+  const Components& getErrors() const
+  {
+    return errors_;
+  }
+
+  const Components& getLimits() const
+  {
+    return limits_;
+  }
+
+  /**
+   * @brief Name of \a component, e.g. "position error in x"
+   */
+  static const char* getComponentName(int component);
+
+private:
+  Components limits_;
+  Components errors_;
+};
+
+}  // namespace cartesian_ros_control
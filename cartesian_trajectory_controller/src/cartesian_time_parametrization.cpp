@@ -0,0 +1,498 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_trajectory_controller/cartesian_time_parametrization.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Eigen/Geometry>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+const double INF = std::numeric_limits<double>::infinity();
+const double EPSILON = 1e-12;
+const int MAX_JERK_ITERATIONS = 8;
+const size_t MIN_INTERVALS = 256;  ///< Shorter paths are subdivided so that the grid resolves the ramps
+
+/**
+ * @brief Relative tolerance for comparing bounds on x and u
+ */
+bool lessOrEqual(double a, double b)
+{
+  return a <= b + 1e-9 * (1.0 + std::abs(b));
+}
+
+Eigen::Quaterniond toQuaternion(const geometry_msgs::Quaternion& q)
+{
+  return Eigen::Quaterniond(q.w, q.x, q.y, q.z).normalized();
+}
+
+void toVector3(const Eigen::Vector3d& in, geometry_msgs::Vector3& out)
+{
+  out.x = in.x();
+  out.y = in.y();
+  out.z = in.z();
+}
+}  // namespace
+
+bool CartesianTimeParametrization::setLimits(const Vector6d& velocity, const Vector6d& acceleration,
+                                             const Vector6d& jerk, std::string& error)
+{
+  if ((velocity.array() < 0.0).any() || (acceleration.array() < 0.0).any() || (jerk.array() < 0.0).any())
+  {
+    error = "Limits must not be negative.";
+    return false;
+  }
+  if ((velocity.array() == 0.0).all() && (acceleration.array() == 0.0).all())
+  {
+    error = "At least one velocity or acceleration limit is required.";
+    return false;
+  }
+  max_velocity_ = velocity;
+  max_acceleration_ = acceleration;
+  max_jerk_ = jerk;
+  return true;
+}
+
+bool CartesianTimeParametrization::retime(cartesian_control_msgs::CartesianTrajectory& trajectory, std::string& error)
+{
+  if ((max_velocity_.array() == 0.0).all() && (max_acceleration_.array() == 0.0).all())
+  {
+    error = "No limits given.";
+    return false;
+  }
+
+  std::vector<cartesian_control_msgs::CartesianTrajectoryPoint>& points = trajectory.points;
+  const size_t n = points.size();
+  if (n < 2)
+  {
+    error = "At least two waypoints are required.";
+    return false;
+  }
+
+  // Path increments on the grid, with every waypoint segment split into
+  // equal parts. Rotations are rotation vectors in the reference frame.
+  const size_t parts = (MIN_INTERVALS + n - 2) / (n - 1);
+  const size_t grid_size = (n - 1) * parts + 1;
+  Matrix6Xd increments(6, grid_size - 1);
+  for (size_t i = 0; i + 1 < n; ++i)
+  {
+    const geometry_msgs::Point& p0 = points[i].pose.position;
+    const geometry_msgs::Point& p1 = points[i + 1].pose.position;
+    Vector6d increment;
+    increment.head<3>() << p1.x - p0.x, p1.y - p0.y, p1.z - p0.z;
+
+    const Eigen::AngleAxisd rotation(toQuaternion(points[i + 1].pose.orientation) *
+                                     toQuaternion(points[i].pose.orientation).inverse());
+    increment.tail<3>() = rotation.angle() * rotation.axis();
+    increments.middleCols(i * parts, parts).colwise() = increment / static_cast<double>(parts);
+  }
+
+  tangents_.resize(6, grid_size);
+  curvatures_.resize(6, grid_size);
+  tangents_.col(0) = increments.col(0);
+  tangents_.col(grid_size - 1) = increments.col(grid_size - 2);
+  curvatures_.col(0).setZero();
+  curvatures_.col(grid_size - 1).setZero();
+  for (size_t i = 1; i + 1 < grid_size; ++i)
+  {
+    tangents_.col(i) = 0.5 * (increments.col(i - 1) + increments.col(i));
+    curvatures_.col(i) = increments.col(i) - increments.col(i - 1);
+  }
+
+  // Velocity limits, and acceleration limits where the path stands still
+  velocity_bounds_.assign(grid_size, INF);
+  for (size_t i = 0; i < grid_size; ++i)
+  {
+    for (int k = 0; k < 6; ++k)
+    {
+      const double tangent = std::abs(tangents_(k, i));
+      const double curvature = std::abs(curvatures_(k, i));
+      if (max_velocity_[k] > 0.0 && tangent > EPSILON)
+      {
+        const double bound = max_velocity_[k] / tangent;
+        velocity_bounds_[i] = std::min(velocity_bounds_[i], bound * bound);
+      }
+      if (max_acceleration_[k] > 0.0 && tangent <= EPSILON && curvature > EPSILON)
+      {
+        velocity_bounds_[i] = std::min(velocity_bounds_[i], max_acceleration_[k] / curvature);
+      }
+    }
+  }
+
+  computeProfile();
+  if (!integrate(error) || !limitJerk(error))
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    const size_t g = i * parts;
+    cartesian_control_msgs::CartesianTrajectoryPoint& point = points[i];
+    point.time_from_start = ros::Duration(times_[g]);
+
+    const Vector6d twist = tangents_.col(g) * std::sqrt(x_[g]);
+    toVector3(twist.head<3>(), point.twist.linear);
+    toVector3(twist.tail<3>(), point.twist.angular);
+    toVector3(accelerations_.col(g).head<3>(), point.acceleration.linear);
+    toVector3(accelerations_.col(g).tail<3>(), point.acceleration.angular);
+
+    Vector6d jerk = Vector6d::Zero();
+    if (g + 1 < grid_size)
+    {
+      jerk = (accelerations_.col(g + 1) - accelerations_.col(g)) / (times_[g + 1] - times_[g]);
+    }
+    toVector3(jerk.head<3>(), point.jerk.linear);
+    toVector3(jerk.tail<3>(), point.jerk.angular);
+  }
+  return true;
+}
+
+void CartesianTimeParametrization::accelerationBounds(size_t i, double x, double& lower, double& upper) const
+{
+  // |tangent * u + curvature * x| <= max_acceleration for each axis
+  lower = -INF;
+  upper = INF;
+  for (int k = 0; k < 6; ++k)
+  {
+    const double tangent = tangents_(k, i);
+    if (max_acceleration_[k] <= 0.0 || std::abs(tangent) <= EPSILON)
+    {
+      continue;
+    }
+    const double offset = curvatures_(k, i) * x;
+    double low = (-max_acceleration_[k] - offset) / tangent;
+    double high = (max_acceleration_[k] - offset) / tangent;
+    if (tangent < 0.0)
+    {
+      std::swap(low, high);
+    }
+    lower = std::max(lower, low);
+    upper = std::min(upper, high);
+  }
+}
+
+bool CartesianTimeParametrization::isFeasible(size_t i, double x, double x_next) const
+{
+  // Some u within the acceleration limits must reach [0, x_next] at the next waypoint: x_next = x + 2u
+  double lower, upper;
+  accelerationBounds(i, x, lower, upper);
+  return lessOrEqual(std::max(lower, -0.5 * x), std::min(upper, 0.5 * (x_next - x)));
+}
+
+double CartesianTimeParametrization::maxFeasible(size_t i, double x_next) const
+{
+  // The feasible x form an interval that contains zero, so we can bisect.
+  double high = velocity_bounds_[i];
+  if (std::isinf(high))
+  {
+    high = std::max(1.0, 2.0 * x_next);
+    while (isFeasible(i, high, x_next))
+    {
+      high *= 2.0;
+      if (high > 1e12)
+      {
+        return high;
+      }
+    }
+  }
+  else if (isFeasible(i, high, x_next))
+  {
+    return high;
+  }
+
+  double low = 0.0;
+  while (high - low > 1e-9 * high)
+  {
+    const double middle = 0.5 * (low + high);
+    if (isFeasible(i, middle, x_next))
+    {
+      low = middle;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+void CartesianTimeParametrization::computeProfile()
+{
+  const size_t n = velocity_bounds_.size();
+
+  // Backward pass: Controllable sets, ending at rest
+  controllable_.resize(n);
+  controllable_[n - 1] = 0.0;
+  for (size_t i = n - 1; i-- > 0;)
+  {
+    controllable_[i] = maxFeasible(i, controllable_[i + 1]);
+  }
+
+  // Forward pass: Greedy acceleration, starting at rest
+  x_.resize(n);
+  x_[0] = 0.0;
+  for (size_t i = 0; i + 1 < n; ++i)
+  {
+    double lower, upper;
+    accelerationBounds(i, x_[i], lower, upper);
+    const double u = std::max(std::min(upper, 0.5 * (controllable_[i + 1] - x_[i])), -0.5 * x_[i]);
+    x_[i + 1] = std::min(std::max(x_[i] + 2.0 * u, 0.0), controllable_[i + 1]);
+  }
+}
+
+bool CartesianTimeParametrization::integrate(std::string& error)
+{
+  const size_t n = x_.size();
+  u_.resize(n);
+  times_.resize(n);
+  accelerations_.resize(6, n);
+  times_[0] = 0.0;
+  for (size_t i = 0; i + 1 < n; ++i)
+  {
+    u_[i] = 0.5 * (x_[i + 1] - x_[i]);
+
+    const double speed = std::sqrt(x_[i]) + std::sqrt(x_[i + 1]);
+    if (speed <= EPSILON)
+    {
+      error = "The path stalls at waypoint " + std::to_string(i) + " within the given limits.";
+      return false;
+    }
+    times_[i + 1] = times_[i] + 2.0 / speed;
+  }
+  u_[n - 1] = u_[n - 2];
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    accelerations_.col(i) = curvatures_.col(i) * x_[i] + tangents_.col(i) * u_[i];
+  }
+  return true;
+}
+
+void CartesianTimeParametrization::limitRatios(double& velocity, double& acceleration, double& jerk) const
+{
+  velocity = 0.0;
+  acceleration = 0.0;
+  jerk = 0.0;
+  for (size_t i = 0; i < x_.size(); ++i)
+  {
+    const double speed = std::sqrt(x_[i]);
+    for (int k = 0; k < 6; ++k)
+    {
+      if (max_velocity_[k] > 0.0)
+      {
+        velocity = std::max(velocity, std::abs(tangents_(k, i)) * speed / max_velocity_[k]);
+      }
+      if (max_acceleration_[k] > 0.0)
+      {
+        acceleration = std::max(acceleration, std::abs(accelerations_(k, i)) / max_acceleration_[k]);
+      }
+      if (max_jerk_[k] > 0.0 && i + 1 < x_.size())
+      {
+        const double change = accelerations_(k, i + 1) - accelerations_(k, i);
+        jerk = std::max(jerk, std::abs(change) / (times_[i + 1] - times_[i]) / max_jerk_[k]);
+      }
+    }
+  }
+}
+
+bool CartesianTimeParametrization::limitJerk(std::string& error)
+{
+  if ((max_jerk_.array() == 0.0).all())
+  {
+    return true;
+  }
+
+  // Building up the profile's largest accelerations within the jerk limits
+  // takes at least this long.
+  double ramp = 0.0;
+  for (int k = 0; k < 6; ++k)
+  {
+    if (max_jerk_[k] > 0.0)
+    {
+      ramp = std::max(ramp, accelerations_.row(k).cwiseAbs().maxCoeff() / max_jerk_[k]);
+    }
+  }
+  if (ramp <= EPSILON)
+  {
+    return true;
+  }
+
+  const size_t n = x_.size();
+  profile_times_ = times_;
+  profile_x_ = x_;
+  profile_u_ = u_;
+  areas_.resize(n);
+  areas_[0] = 0.0;
+  for (size_t i = 0; i + 1 < n; ++i)
+  {
+    const double duration = profile_times_[i + 1] - profile_times_[i];
+    const double speed = std::sqrt(profile_x_[i]);
+    areas_[i + 1] = areas_[i] + duration * (i + duration * (speed / 2.0 + duration * profile_u_[i] / 6.0));
+  }
+
+  // A step in the path acceleration becomes a ramp over the whole window.
+  // Steps across zero need twice the window, and so on.
+  double velocity, acceleration, jerk;
+  double last_jerk = INF;
+  for (int iteration = 0; iteration < MAX_JERK_ITERATIONS; ++iteration)
+  {
+    if (!smooth(ramp, error))
+    {
+      return false;
+    }
+    limitRatios(velocity, acceleration, jerk);
+    if (jerk <= 1.0 + 1e-6 || jerk > 0.99 * last_jerk)
+    {
+      break;
+    }
+    last_jerk = jerk;
+    ramp *= jerk;
+  }
+
+  // What remains, e.g. jerk from the path's curvature, is removed by slowing
+  // down uniformly. That scales velocities by 1 / scale, accelerations by
+  // 1 / scale^2 and jerks by 1 / scale^3.
+  const double scale = std::max({ 1.0, velocity, std::sqrt(acceleration), std::cbrt(jerk * (1.0 + 1e-9)) });
+  if (scale > 1.0)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      times_[i] *= scale;
+      x_[i] /= scale * scale;
+      u_[i] /= scale * scale;
+    }
+    accelerations_ /= scale * scale;
+  }
+  return true;
+}
+
+void CartesianTimeParametrization::sampleProfile(double t, double& area, double& s, double& v) const
+{
+  // At rest before the start and after the end
+  const size_t n = profile_times_.size();
+  if (t <= 0.0)
+  {
+    area = 0.0;
+    s = 0.0;
+    v = 0.0;
+    return;
+  }
+  if (t >= profile_times_[n - 1])
+  {
+    area = areas_[n - 1] + (n - 1) * (t - profile_times_[n - 1]);
+    s = n - 1;
+    v = 0.0;
+    return;
+  }
+
+  // Constant path acceleration between grid points
+  const size_t i = std::upper_bound(profile_times_.begin(), profile_times_.end(), t) - profile_times_.begin() - 1;
+  const double tau = t - profile_times_[i];
+  const double v0 = std::sqrt(profile_x_[i]);
+  const double u = profile_u_[i];
+  area = areas_[i] + tau * (i + tau * (v0 / 2.0 + tau * u / 6.0));
+  s = i + tau * (v0 + tau * u / 2.0);
+  v = v0 + tau * u;
+}
+
+bool CartesianTimeParametrization::smooth(double ramp, std::string& error)
+{
+  // Averaging the path position s of the time-optimal profile over a
+  // sliding window of ramp seconds. Velocity and acceleration are then
+  // averaged, too, and steps in the path acceleration become ramps over the
+  // window. The result takes exactly ramp seconds longer.
+  const size_t n = profile_times_.size();
+  const double half = 0.5 * ramp;
+  double area_before, s_before, v_before, area_after, s_after, v_after;
+
+  times_[0] = 0.0;
+  x_[0] = 0.0;
+  u_[0] = 0.0;
+  double low = -half;
+  double speed = 0.0;
+  for (size_t i = 1; i + 1 < n; ++i)
+  {
+    // Safeguarded Newton iterations for the time at which the average passes grid point i
+    double high = profile_times_[n - 1] + half;
+    double t = speed > EPSILON ? std::min(low + 1.0 / speed, high) : 0.5 * (low + high);
+    int iteration = 0;
+    for (; iteration < 200; ++iteration)
+    {
+      sampleProfile(t - half, area_before, s_before, v_before);
+      sampleProfile(t + half, area_after, s_after, v_after);
+      const double offset = (area_after - area_before) / ramp - i;
+      speed = (s_after - s_before) / ramp;
+      if (std::abs(offset) <= 1e-8)
+      {
+        break;
+      }
+      (offset < 0.0 ? low : high) = t;
+
+      const double next = t - offset / speed;
+      t = (speed > EPSILON && next > low && next < high) ? next : 0.5 * (low + high);
+    }
+    if (iteration == 200)
+    {
+      error = "Smoothing the path velocity did not converge at waypoint " + std::to_string(i) + ".";
+      return false;
+    }
+
+    low = t;
+    times_[i] = t + half;
+    x_[i] = speed * speed;
+    u_[i] = (v_after - v_before) / ramp;
+  }
+  times_[n - 1] = profile_times_[n - 1] + ramp;
+  x_[n - 1] = 0.0;
+  u_[n - 1] = 0.0;
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    accelerations_.col(i) = curvatures_.col(i) * x_[i] + tangents_.col(i) * u_[i];
+  }
+  return true;
+}
+
+}  // namespace cartesian_ros_control
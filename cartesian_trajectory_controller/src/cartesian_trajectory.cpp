@@ -0,0 +1,337 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_trajectory_controller/cartesian_trajectory.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+/**
+ * @brief A trajectory waypoint in Eigen types
+ */
+struct Knot
+{
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  double time;
+  Eigen::Vector3d position;
+  Eigen::Vector3d linear_velocity;
+  Eigen::Vector3d linear_acceleration;
+  Eigen::Quaterniond orientation;
+  Eigen::Vector3d angular_velocity;
+  Eigen::Vector3d angular_acceleration;
+};
+
+Knot toKnot(double time, const geometry_msgs::Pose& pose, const geometry_msgs::Twist& twist,
+            const geometry_msgs::Accel& accel)
+{
+  Knot knot;
+  knot.time = time;
+  knot.position = Eigen::Map<const Eigen::Vector3d>(&pose.position.x);
+  knot.orientation = Eigen::Map<const Eigen::Quaterniond>(&pose.orientation.x);
+  knot.linear_velocity = Eigen::Map<const Eigen::Vector3d>(&twist.linear.x);
+  knot.angular_velocity = Eigen::Map<const Eigen::Vector3d>(&twist.angular.x);
+  knot.linear_acceleration = Eigen::Map<const Eigen::Vector3d>(&accel.linear.x);
+  knot.angular_acceleration = Eigen::Map<const Eigen::Vector3d>(&accel.angular.x);
+  return knot;
+}
+
+bool isFinite(const Knot& knot)
+{
+  return knot.position.allFinite() && knot.orientation.coeffs().allFinite() && knot.linear_velocity.allFinite() &&
+         knot.angular_velocity.allFinite() && knot.linear_acceleration.allFinite() &&
+         knot.angular_acceleration.allFinite();
+}
+
+Eigen::Matrix3d skew(const Eigen::Vector3d& v)
+{
+  Eigen::Matrix3d m;
+  m << 0.0, -v.z(), v.y(), v.z(), 0.0, -v.x(), -v.y(), v.x(), 0.0;
+  return m;
+}
+
+/**
+ * @brief Left Jacobian of SO(3)
+ *
+ * Maps the derivative of a rotation vector \a phi onto the angular velocity
+ * of exp(phi) in the reference frame.
+ */
+Eigen::Matrix3d leftJacobian(const Eigen::Vector3d& phi)
+{
+  const double theta = phi.norm();
+  const Eigen::Matrix3d phi_x = skew(phi);
+  if (theta < 1e-6)
+  {
+    return Eigen::Matrix3d::Identity() + 0.5 * phi_x + phi_x * phi_x / 6.0;
+  }
+  const double theta2 = theta * theta;
+  return Eigen::Matrix3d::Identity() + (1.0 - std::cos(theta)) / theta2 * phi_x +
+         (theta - std::sin(theta)) / (theta2 * theta) * phi_x * phi_x;
+}
+
+/**
+ * @brief Inverse of leftJacobian() for rotation angles in [0, pi]
+ */
+Eigen::Matrix3d inverseLeftJacobian(const Eigen::Vector3d& phi)
+{
+  const double theta = phi.norm();
+  const Eigen::Matrix3d phi_x = skew(phi);
+  if (theta < 1e-6)
+  {
+    return Eigen::Matrix3d::Identity() - 0.5 * phi_x + phi_x * phi_x / 12.0;
+  }
+  return Eigen::Matrix3d::Identity() - 0.5 * phi_x +
+         (1.0 / (theta * theta) - 1.0 / (2.0 * theta * std::tan(0.5 * theta))) * phi_x * phi_x;
+}
+
+Eigen::Quaterniond expMap(const Eigen::Vector3d& phi)
+{
+  const double theta = phi.norm();
+  if (theta < 1e-12)
+  {
+    return Eigen::Quaterniond::Identity();
+  }
+  return Eigen::Quaterniond(Eigen::AngleAxisd(theta, phi / theta));
+}
+
+/**
+ * @brief Coefficients of three quintic polynomials with the given boundary conditions
+ *
+ * Column k holds the coefficients of t^k.
+ */
+Eigen::Matrix<double, 3, 6> quintic(const Eigen::Vector3d& p0, const Eigen::Vector3d& v0, const Eigen::Vector3d& a0,
+                                    const Eigen::Vector3d& p1, const Eigen::Vector3d& v1, const Eigen::Vector3d& a1,
+                                    double duration)
+{
+  Eigen::Matrix<double, 3, 6> c;
+  c.col(0) = p0;
+  c.col(1) = v0;
+  c.col(2) = 0.5 * a0;
+
+  const double t = duration;
+  const double t2 = t * t;
+  const double t3 = t2 * t;
+  c.col(3) = (20.0 * (p1 - p0) - (8.0 * v1 + 12.0 * v0) * t - (3.0 * a0 - a1) * t2) / (2.0 * t3);
+  c.col(4) = (30.0 * (p0 - p1) + (14.0 * v1 + 16.0 * v0) * t + (3.0 * a0 - 2.0 * a1) * t2) / (2.0 * t3 * t);
+  c.col(5) = (12.0 * (p1 - p0) - 6.0 * (v1 + v0) * t - (a0 - a1) * t2) / (2.0 * t3 * t2);
+  return c;
+}
+
+/**
+ * @brief Evaluate value and the first three derivatives of quintic polynomials with Horner's scheme
+ */
+void evaluate(const Eigen::Matrix<double, 3, 6>& c, double t, Eigen::Vector3d& p, Eigen::Vector3d& v,
+              Eigen::Vector3d& a, Eigen::Vector3d& j)
+{
+  p = ((((c.col(5) * t + c.col(4)) * t + c.col(3)) * t + c.col(2)) * t + c.col(1)) * t + c.col(0);
+  v = (((5.0 * c.col(5) * t + 4.0 * c.col(4)) * t + 3.0 * c.col(3)) * t + 2.0 * c.col(2)) * t + c.col(1);
+  a = ((20.0 * c.col(5) * t + 12.0 * c.col(4)) * t + 6.0 * c.col(3)) * t + 2.0 * c.col(2);
+  j = (60.0 * c.col(5) * t + 24.0 * c.col(4)) * t + 6.0 * c.col(3);
+}
+}  // namespace
+
+bool CartesianTrajectory::init(const cartesian_control_msgs::CartesianTrajectory& msg,
+                               const CartesianState& start_state, std::string& error)
+{
+  segments_.clear();
+  cursor_ = 0;
+
+  if (msg.points.empty())
+  {
+    error = "Trajectory has no waypoints.";
+    return false;
+  }
+
+  std::vector<Knot, Eigen::aligned_allocator<Knot>> knots;
+  knots.reserve(msg.points.size() + 1);
+
+  if (msg.points.front().time_from_start.toSec() > 0.0)
+  {
+    knots.push_back(toKnot(0.0, start_state.pose, start_state.twist, start_state.accel));
+    knots.back().orientation.normalize();
+  }
+
+  for (size_t i = 0; i < msg.points.size(); ++i)
+  {
+    const cartesian_control_msgs::CartesianTrajectoryPoint& point = msg.points[i];
+    Knot knot = toKnot(point.time_from_start.toSec(), point.pose, point.twist, point.acceleration);
+
+    if (knot.time < 0.0 || (!knots.empty() && knot.time <= knots.back().time))
+    {
+      error = "Waypoint " + std::to_string(i) + " is not strictly increasing in time_from_start.";
+      return false;
+    }
+    if (!isFinite(knot))
+    {
+      error = "Waypoint " + std::to_string(i) + " has non-finite values.";
+      return false;
+    }
+    if (std::abs(knot.orientation.norm() - 1.0) > 1e-3)
+    {
+      error = "Waypoint " + std::to_string(i) + " has a non-normalized orientation quaternion.";
+      return false;
+    }
+    knot.orientation.normalize();
+
+    knots.push_back(knot);
+  }
+
+  if (knots.size() == 1)
+  {
+    // A single waypoint at time zero. Hold it.
+    Segment segment;
+    segment.start_time = knots[0].time;
+    segment.duration = 0.0;
+    segment.start_orientation = knots[0].orientation;
+    segment.position.setZero();
+    segment.position.col(0) = knots[0].position;
+    segment.rotation.setZero();
+    segments_.push_back(segment);
+    return true;
+  }
+
+  segments_.reserve(knots.size() - 1);
+  for (size_t i = 0; i + 1 < knots.size(); ++i)
+  {
+    const Knot& begin = knots[i];
+    const Knot& end = knots[i + 1];
+
+    Segment segment;
+    segment.start_time = begin.time;
+    segment.duration = end.time - begin.time;
+    segment.start_orientation = begin.orientation;
+    segment.position = quintic(begin.position, begin.linear_velocity, begin.linear_acceleration, end.position,
+                               end.linear_velocity, end.linear_acceleration, segment.duration);
+
+    // AngleAxis yields the shortest rotation with angles in [0, pi].
+    const Eigen::AngleAxisd delta(end.orientation * begin.orientation.inverse());
+    const Eigen::Vector3d rotation = delta.axis() * delta.angle();
+    const Eigen::Matrix3d inverse_jacobian = inverseLeftJacobian(rotation);
+    segment.rotation = quintic(Eigen::Vector3d::Zero(), begin.angular_velocity, begin.angular_acceleration, rotation,
+                               inverse_jacobian * end.angular_velocity, inverse_jacobian * end.angular_acceleration,
+                               segment.duration);
+
+    segments_.push_back(segment);
+  }
+  return true;
+}
+
+void CartesianTrajectory::sample(double time, CartesianState& state)
+{
+  assert(!segments_.empty());
+
+  bool at_rest = false;
+  size_t index;
+  double t;
+  if (time <= segments_.front().start_time)
+  {
+    index = 0;
+    t = 0.0;
+    at_rest = true;
+  }
+  else if (time >= segments_.back().start_time + segments_.back().duration)
+  {
+    index = segments_.size() - 1;
+    t = segments_.back().duration;
+    at_rest = true;
+  }
+  else
+  {
+    index = findSegment(time);
+    t = time - segments_[index].start_time;
+  }
+  const Segment& segment = segments_[index];
+
+  Eigen::Vector3d position, linear_velocity, linear_acceleration, linear_jerk;
+  Eigen::Vector3d rotation, rotation_rate, rotation_acceleration, rotation_jerk;
+  evaluate(segment.position, t, position, linear_velocity, linear_acceleration, linear_jerk);
+  evaluate(segment.rotation, t, rotation, rotation_rate, rotation_acceleration, rotation_jerk);
+
+  Eigen::Map<Eigen::Vector3d>(&state.pose.position.x) = position;
+  Eigen::Map<Eigen::Quaterniond>(&state.pose.orientation.x) = expMap(rotation) * segment.start_orientation;
+
+  if (at_rest)
+  {
+    state.twist = geometry_msgs::Twist();
+    state.accel = geometry_msgs::Accel();
+    state.jerk = geometry_msgs::Accel();
+    return;
+  }
+
+  // Neglects the time derivatives of the Jacobian for the higher orders.
+  const Eigen::Matrix3d jacobian = leftJacobian(rotation);
+  Eigen::Map<Eigen::Vector3d>(&state.twist.linear.x) = linear_velocity;
+  Eigen::Map<Eigen::Vector3d>(&state.twist.angular.x) = jacobian * rotation_rate;
+  Eigen::Map<Eigen::Vector3d>(&state.accel.linear.x) = linear_acceleration;
+  Eigen::Map<Eigen::Vector3d>(&state.accel.angular.x) = jacobian * rotation_acceleration;
+  Eigen::Map<Eigen::Vector3d>(&state.jerk.linear.x) = linear_jerk;
+  Eigen::Map<Eigen::Vector3d>(&state.jerk.angular.x) = jacobian * rotation_jerk;
+}
+
+double CartesianTrajectory::getDuration() const
+{
+  return segments_.empty() ? 0.0 : segments_.back().start_time + segments_.back().duration;
+}
+
+size_t CartesianTrajectory::findSegment(double time)
+{
+  // Real-time loops advance by at most one segment per cycle in most cases.
+  const Segment& current = segments_[cursor_];
+  if (time >= current.start_time)
+  {
+    if (time < current.start_time + current.duration)
+    {
+      return cursor_;
+    }
+    if (cursor_ + 1 < segments_.size() && time < segments_[cursor_ + 1].start_time + segments_[cursor_ + 1].duration)
+    {
+      return ++cursor_;
+    }
+  }
+
+  auto next = std::upper_bound(segments_.begin(), segments_.end(), time,
+                               [](double t, const Segment& segment) { return t < segment.start_time; });
+  cursor_ = (next == segments_.begin()) ? 0 : static_cast<size_t>(next - segments_.begin() - 1);
+  return cursor_;
+}
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,707 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_trajectory_controller/cartesian_trajectory_controller.h>
+#include <pluginlib/class_list_macros.hpp>
+
+#include <limits>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+bool isActive(const actionlib::ServerGoalHandle<cartesian_control_msgs::FollowCartesianTrajectoryAction>& gh)
+{
+  const uint8_t status = gh.getGoalStatus().status;
+  return status == actionlib_msgs::GoalStatus::ACTIVE || status == actionlib_msgs::GoalStatus::PENDING;
+}
+
+void setToleranceViolated(
+    realtime_tools::RealtimeServerGoalHandle<cartesian_control_msgs::FollowCartesianTrajectoryAction>& goal_handle,
+    int32_t error_code, const char* reason, int component)
+{
+  // The error string's capacity is reserved when the goal arrives
+  cartesian_control_msgs::FollowCartesianTrajectoryResult& result = *goal_handle.preallocated_result_;
+  result.error_code = error_code;
+  result.error_string.assign(reason);
+  result.error_string.append(ToleranceChecker::getComponentName(component));
+  goal_handle.setAborted(goal_handle.preallocated_result_);
+}
+
+Eigen::Map<const Eigen::Vector3d> map(const geometry_msgs::Vector3& vector)
+{
+  return Eigen::Map<const Eigen::Vector3d>(&vector.x);
+}
+
+void subtract(const geometry_msgs::Vector3& a, const geometry_msgs::Vector3& b, geometry_msgs::Vector3& difference)
+{
+  Eigen::Map<Eigen::Vector3d>(&difference.x) = map(a) - map(b);
+}
+
+void toPoint(const CartesianState& state, const ros::Duration& time,
+             cartesian_control_msgs::CartesianTrajectoryPoint& point)
+{
+  point.time_from_start = time;
+  point.pose = state.pose;
+  point.twist = state.twist;
+  point.acceleration = state.accel;
+  point.jerk = state.jerk;
+}
+}  // namespace
+
+CartesianTrajectoryController::CartesianTrajectoryController()
+  : controller_interface::MultiInterfaceController<PoseCommandInterface, PoseTwistAccelCommandInterface,
+                                                    PostureCommandInterface>(true)
+{
+}
+
+bool CartesianTrajectoryController::init(hardware_interface::RobotHW* hw, ros::NodeHandle& /*root_nh*/,
+                                         ros::NodeHandle& controller_nh)
+{
+  controller_nh_ = controller_nh;
+
+  std::string frame_id;
+  if (!controller_nh.getParam("frame_id", frame_id))
+  {
+    ROS_ERROR_STREAM("Required parameter " << controller_nh.resolveName("frame_id") << " not given");
+    return false;
+  }
+
+  if (PoseTwistAccelCommandInterface* iface = hw->get<PoseTwistAccelCommandInterface>())
+  {
+    feedforward_handle_ = iface->getHandle(frame_id);
+    state_handle_ = feedforward_handle_;
+    has_feedforward_ = true;
+  }
+  else if (PoseCommandInterface* iface = hw->get<PoseCommandInterface>())
+  {
+    pose_handle_ = iface->getHandle(frame_id);
+    state_handle_ = pose_handle_;
+    has_feedforward_ = false;
+  }
+  else
+  {
+    ROS_ERROR_STREAM("Neither a PoseTwistAccelCommandInterface nor a PoseCommandInterface is available.");
+    return false;
+  }
+
+  has_posture_ = false;
+  if (PostureCommandInterface* iface = hw->get<PostureCommandInterface>())
+  {
+    try
+    {
+      posture_handle_ = iface->getHandle(frame_id);
+      has_posture_ = true;
+    }
+    catch (const hardware_interface::HardwareInterfaceException&)
+    {
+      // Postures are optional
+    }
+  }
+
+  std::vector<std::string> joint_names;
+  if (!controller_nh.getParam("joints", joint_names))
+  {
+    ROS_ERROR_STREAM("Failed to read required parameter '" << controller_nh.resolveName("joints") << ".");
+    return false;
+  }
+
+  for (auto& name : joint_names)
+  {
+    if (has_feedforward_)
+    {
+      hw->get<PoseTwistAccelCommandInterface>()->claim(name);
+    }
+    else
+    {
+      hw->get<PoseCommandInterface>()->claim(name);
+    }
+  }
+
+  streaming_ = controller_nh.param("streaming", false);
+  if (streaming_)
+  {
+    int stream_capacity = controller_nh.param("stream_capacity", 16);
+    if (stream_capacity < 1)
+    {
+      ROS_ERROR_STREAM("Parameter " << controller_nh.resolveName("stream_capacity") << " must be positive.");
+      return false;
+    }
+    stream_queue_.reset(stream_capacity);
+
+    // Every queued goal plus the one in execution can be retired before we
+    // get to release them.
+    retired_goals_.reset(stream_capacity + 1);
+  }
+
+  double action_monitor_rate = controller_nh.param("action_monitor_rate", 20.0);
+  action_monitor_period_ = ros::Duration(1.0 / action_monitor_rate);
+  goal_handle_timer_ = controller_nh_.createTimer(action_monitor_period_,
+                                                  &CartesianTrajectoryController::goalHandleTimerCallback, this);
+
+  double feedback_rate = controller_nh.param("feedback_rate", 25.0);
+  feedback_period_ = ros::Duration();
+  if (feedback_rate > 0.0)
+  {
+    feedback_period_ = ros::Duration(1.0 / feedback_rate);
+    feedback_timer_ =
+        controller_nh_.createTimer(feedback_period_, &CartesianTrajectoryController::feedbackTimerCallback, this);
+  }
+
+  action_server_.reset(new ActionServer(controller_nh, "follow_cartesian_trajectory",
+                                        boost::bind(&CartesianTrajectoryController::goalCallback, this, _1),
+                                        boost::bind(&CartesianTrajectoryController::cancelCallback, this, _1), false));
+  action_server_->start();
+
+  return true;
+}
+
+void CartesianTrajectoryController::starting(const ros::Time& /*time*/)
+{
+  // Whatever is still buffered belongs to before we stopped. Resetting the
+  // buffer in here would race with the goal callback and could free the goal
+  // in the real-time loop, so we just remember to ignore it.
+  rt_buffered_goal_ = goal_buffer_.readFromRT()->get();
+  if (rt_goal_from_stream_)
+  {
+    // Hand the memory back to the non-real-time side
+    retired_goals_.push(rt_goal_);
+  }
+  rt_goal_ = nullptr;
+  rt_goal_from_stream_ = false;
+  rt_goal_done_ = false;
+  rt_posture_waypoint_ = std::numeric_limits<size_t>::max();
+  if (has_posture_)
+  {
+    posture_handle_.clearPosture();
+  }
+
+  desired_ = state_handle_.getState();
+  holdPose(desired_.pose);
+}
+
+void CartesianTrajectoryController::stopping(const ros::Time& /*time*/)
+{
+  // Canceling allocates. The non-real-time side does that for us.
+  stop_requested_.store(true, std::memory_order_release);
+}
+
+void CartesianTrajectoryController::update(const ros::Time& time, const ros::Duration& /*period*/)
+{
+  // The buffer keeps the goal alive until the next one arrives, so we never
+  // release trajectory memory in here.
+  TrajectoryGoal* buffered_goal = goal_buffer_.readFromRT()->get();
+  if (buffered_goal != rt_buffered_goal_)
+  {
+    rt_buffered_goal_ = buffered_goal;
+    switchGoal(buffered_goal, false,
+               (buffered_goal && !buffered_goal->start_time.isZero()) ? buffered_goal->start_time : time);
+  }
+
+  if (rt_goal_done_)
+  {
+    // Appended goals may arrive after the stream ran dry.
+    TrajectoryGoal* next = popStreamedGoal();
+    if (next)
+    {
+      switchGoal(next, true, time);
+    }
+  }
+
+  if (!rt_goal_ || rt_goal_done_)
+  {
+    writeCommand(hold_);
+    return;
+  }
+
+  double t = (time - rt_start_time_).toSec();
+  double duration = rt_goal_->trajectory.getDuration();
+
+  // Continue seamlessly with appended goals
+  TrajectoryGoal* next = nullptr;
+  while (t >= duration && (next = popStreamedGoal()))
+  {
+    rt_goal_->goal_handle->preallocated_result_->error_code = Result::SUCCESSFUL;
+    rt_goal_->goal_handle->setSucceeded(rt_goal_->goal_handle->preallocated_result_);
+    switchGoal(next, true, rt_start_time_ + ros::Duration(duration));
+    t = (time - rt_start_time_).toSec();
+    duration = rt_goal_->trajectory.getDuration();
+  }
+
+  rt_goal_->trajectory.sample(t, desired_);
+  writeCommand(desired_);
+  writePosture(t);
+
+  const CartesianState actual = state_handle_.getState();
+  const RealtimeGoalHandlePtr& goal_handle = rt_goal_->goal_handle;
+
+  if (!feedback_period_.isZero() && time - rt_last_feedback_ >= feedback_period_)
+  {
+    writeFeedback(time, t, actual);
+    rt_last_feedback_ = time;
+  }
+
+  if (t < duration)
+  {
+    const int violation = rt_goal_->path_tolerance.check(desired_, actual);
+    if (violation >= 0)
+    {
+      abortStream(Result::PATH_TOLERANCE_VIOLATED, "Path tolerance violated: ", violation);
+      holdPose(actual.pose);
+    }
+  }
+  else
+  {
+    const int violation = rt_goal_->goal_tolerance.check(desired_, actual);
+    if (violation < 0)
+    {
+      goal_handle->preallocated_result_->error_code = Result::SUCCESSFUL;
+      goal_handle->setSucceeded(goal_handle->preallocated_result_);
+      holdPose(desired_.pose);
+      rt_goal_done_ = true;
+    }
+    else if (t > duration + rt_goal_->goal_time_tolerance.toSec())
+    {
+      abortStream(Result::GOAL_TOLERANCE_VIOLATED, "Goal tolerance violated: ", violation);
+      holdPose(desired_.pose);
+    }
+  }
+}
+
+void CartesianTrajectoryController::goalCallback(GoalHandle gh)
+{
+  Result result;
+
+  if (!this->isRunning())
+  {
+    result.error_code = Result::INVALID_GOAL;
+    result.error_string = "Can't accept new goals while the controller is not running.";
+    ROS_ERROR_STREAM(result.error_string);
+    gh.setRejected(result, result.error_string);
+    return;
+  }
+
+  const cartesian_control_msgs::FollowCartesianTrajectoryGoal& goal = *gh.getGoal();
+
+  if (!goal.trajectory.controlled_frame.empty() && goal.trajectory.controlled_frame != state_handle_.getName())
+  {
+    result.error_code = Result::INVALID_GOAL;
+    result.error_string = "This controller controls frame '" + state_handle_.getName() + "', not '" +
+                          goal.trajectory.controlled_frame + "'.";
+    ROS_ERROR_STREAM(result.error_string);
+    gh.setRejected(result, result.error_string);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(goal_mutex_);
+  releaseRetiredGoals();
+  cancelStoppedGoals();
+
+  const bool append = streaming_ && active_goal_ && isActive(active_goal_->gh_);
+
+  if (append && !goal.trajectory.points.empty() && goal.trajectory.points.front().time_from_start <= ros::Duration(0))
+  {
+    // The tail of the previous goal is the start knot. A first waypoint at
+    // zero would replace it and make the robot jump.
+    result.error_code = Result::INVALID_GOAL;
+    result.error_string = "Appended goals must start after the last waypoint of the previous goal.";
+    ROS_ERROR_STREAM(result.error_string);
+    gh.setRejected(result, result.error_string);
+    return;
+  }
+
+  TrajectoryGoalPtr trajectory_goal = std::allocate_shared<TrajectoryGoal>(Eigen::aligned_allocator<TrajectoryGoal>());
+  const CartesianState start_state = append ? stream_tail_ : state_handle_.getState();
+  if (!trajectory_goal->trajectory.init(goal.trajectory, start_state, result.error_string))
+  {
+    result.error_code = Result::INVALID_GOAL;
+    ROS_ERROR_STREAM("Rejecting trajectory goal: " << result.error_string);
+    gh.setRejected(result, result.error_string);
+    return;
+  }
+
+  if (!append)
+  {
+    trajectory_goal->start_time = goal.trajectory.header.stamp;
+    if (!trajectory_goal->start_time.isZero() &&
+        trajectory_goal->start_time + ros::Duration(trajectory_goal->trajectory.getDuration()) < ros::Time::now())
+    {
+      result.error_code = Result::OLD_HEADER_TIMESTAMP;
+      result.error_string = "The trajectory would have ended in the past.";
+      ROS_ERROR_STREAM(result.error_string);
+      gh.setRejected(result, result.error_string);
+      return;
+    }
+  }
+
+  if (!resolvePosture(goal.trajectory, trajectory_goal->posture, result.error_string))
+  {
+    result.error_code = Result::INVALID_POSTURE;
+    ROS_ERROR_STREAM("Rejecting trajectory goal: " << result.error_string);
+    gh.setRejected(result, result.error_string);
+    return;
+  }
+
+  trajectory_goal->path_tolerance.init(goal.path_tolerance);
+  trajectory_goal->goal_tolerance.init(goal.goal_tolerance);
+  trajectory_goal->goal_time_tolerance = goal.goal_time_tolerance;
+
+  RealtimeGoalHandlePtr rt_goal(new RealtimeGoalHandle(gh));
+  rt_goal->preallocated_result_->error_string.reserve(128);
+  trajectory_goal->goal_handle = rt_goal;
+
+  if (!feedback_period_.isZero())
+  {
+    Feedback feedback;
+    feedback.header.frame_id = state_handle_.getReferenceFrame();
+    feedback.tcp_frame = state_handle_.getName();
+    trajectory_goal->feedback.reset(feedback);
+  }
+
+  if (append)
+  {
+    trajectory_goal->stream_id = stream_id_;
+    if (!stream_queue_.push(trajectory_goal.get()))
+    {
+      result.error_code = Result::INVALID_GOAL;
+      result.error_string = "Too many goals queued for streaming.";
+      ROS_ERROR_STREAM(result.error_string);
+      gh.setRejected(result, result.error_string);
+      return;
+    }
+    streamed_goals_.push_back(trajectory_goal);
+  }
+  else
+  {
+    preemptActiveGoal("Preempted by a new goal.");
+    trajectory_goal->stream_id = ++stream_id_;
+    goal_buffer_.writeFromNonRT(trajectory_goal);
+  }
+
+  gh.setAccepted();
+  active_goal_ = rt_goal;
+  monitored_goals_.push_back(trajectory_goal);
+
+  const cartesian_control_msgs::CartesianTrajectoryPoint& tail = goal.trajectory.points.back();
+  stream_tail_.pose = tail.pose;
+  stream_tail_.twist = tail.twist;
+  stream_tail_.accel = tail.acceleration;
+}
+
+void CartesianTrajectoryController::cancelCallback(GoalHandle gh)
+{
+  std::lock_guard<std::mutex> lock(goal_mutex_);
+  for (const TrajectoryGoalPtr& goal : monitored_goals_)
+  {
+    if (goal->goal_handle->gh_ == gh)
+    {
+      // Canceling any part of a stream stops the whole stream. An empty goal
+      // makes the real-time loop stop where it is.
+      preemptActiveGoal("Canceled on request.");
+      goal_buffer_.writeFromNonRT(TrajectoryGoalPtr());
+      return;
+    }
+  }
+}
+
+void CartesianTrajectoryController::goalHandleTimerCallback(const ros::TimerEvent& event)
+{
+  std::lock_guard<std::mutex> lock(goal_mutex_);
+  releaseRetiredGoals();
+
+  for (auto it = monitored_goals_.begin(); it != monitored_goals_.end();)
+  {
+    (*it)->goal_handle->runNonRealtime(event);
+    it = isActive((*it)->goal_handle->gh_) ? it + 1 : monitored_goals_.erase(it);
+  }
+
+  // Goals the real-time loop finished before stopping keep their result
+  cancelStoppedGoals();
+}
+
+void CartesianTrajectoryController::feedbackTimerCallback(const ros::TimerEvent& /*event*/)
+{
+  std::lock_guard<std::mutex> lock(goal_mutex_);
+  for (const TrajectoryGoalPtr& goal : monitored_goals_)
+  {
+    if (goal->feedback.update() && isActive(goal->goal_handle->gh_))
+    {
+      goal->goal_handle->gh_.publishFeedback(goal->feedback.getReadBuffer());
+    }
+  }
+}
+
+void CartesianTrajectoryController::preemptActiveGoal(const std::string& reason)
+{
+  for (const TrajectoryGoalPtr& goal : monitored_goals_)
+  {
+    GoalHandle& gh = goal->goal_handle->gh_;
+    const uint8_t status = gh.getGoalStatus().status;
+    if (isActive(gh) || status == actionlib_msgs::GoalStatus::PREEMPTING)
+    {
+      Result result;
+      result.error_code = Result::SUCCESSFUL;
+      gh.setCanceled(result, reason);
+    }
+  }
+  monitored_goals_.clear();
+  active_goal_.reset();
+
+  // Appended goals of this stream that the real-time loop hasn't started yet are dropped.
+  canceled_stream_.store(stream_id_, std::memory_order_release);
+}
+
+void CartesianTrajectoryController::cancelStoppedGoals()
+{
+  if (stop_requested_.exchange(false, std::memory_order_acquire))
+  {
+    preemptActiveGoal("The controller was stopped.");
+  }
+}
+
+void CartesianTrajectoryController::releaseRetiredGoals()
+{
+  const TrajectoryGoal* retired = nullptr;
+  while (retired_goals_.pop(retired))
+  {
+    for (auto it = streamed_goals_.begin(); it != streamed_goals_.end(); ++it)
+    {
+      if (it->get() == retired)
+      {
+        streamed_goals_.erase(it);
+        break;
+      }
+    }
+  }
+}
+
+void CartesianTrajectoryController::switchGoal(TrajectoryGoal* goal, bool from_stream, const ros::Time& start_time)
+{
+  if (rt_goal_ && !rt_goal_done_)
+  {
+    // Preempted or canceled. Stop where we are.
+    holdPose(desired_.pose);
+  }
+  if (rt_goal_from_stream_)
+  {
+    // Hand the memory back to the non-real-time side
+    retired_goals_.push(rt_goal_);
+  }
+
+  rt_goal_ = goal;
+  rt_goal_from_stream_ = from_stream;
+  rt_goal_done_ = false;
+  rt_start_time_ = start_time;
+
+  rt_posture_waypoint_ = std::numeric_limits<size_t>::max();
+  if (has_posture_)
+  {
+    posture_handle_.clearPosture();
+  }
+}
+
+CartesianTrajectoryController::TrajectoryGoal* CartesianTrajectoryController::popStreamedGoal()
+{
+  if (!streaming_)
+  {
+    return nullptr;
+  }
+
+  const uint64_t canceled_stream = canceled_stream_.load(std::memory_order_acquire);
+  TrajectoryGoal* const* front;
+  while ((front = stream_queue_.front()))
+  {
+    TrajectoryGoal* goal = *front;
+    if (goal->stream_id > canceled_stream && goal->stream_id != rt_aborted_stream_)
+    {
+      if (!rt_goal_ || goal->stream_id != rt_goal_->stream_id)
+      {
+        // Belongs to a new stream whose first goal hasn't reached us yet
+        return nullptr;
+      }
+      stream_queue_.pop(goal);
+      return goal;
+    }
+
+    // Stale goals of canceled or aborted streams
+    stream_queue_.pop(goal);
+    if (goal->stream_id == rt_aborted_stream_)
+    {
+      // Same error as the goal that aborted the stream
+      setToleranceViolated(*goal->goal_handle, rt_aborted_error_code_, rt_aborted_reason_, rt_aborted_component_);
+    }
+    retired_goals_.push(goal);
+  }
+  return nullptr;
+}
+
+void CartesianTrajectoryController::abortStream(int32_t error_code, const char* reason, int component)
+{
+  setToleranceViolated(*rt_goal_->goal_handle, error_code, reason, component);
+  rt_goal_done_ = true;
+  rt_aborted_stream_ = rt_goal_->stream_id;
+  rt_aborted_error_code_ = error_code;
+  rt_aborted_reason_ = reason;
+  rt_aborted_component_ = component;
+}
+
+void CartesianTrajectoryController::writeCommand(const CartesianState& setpoint)
+{
+  if (has_feedforward_)
+  {
+    feedforward_handle_.setCommand(setpoint.pose, setpoint.twist, setpoint.accel);
+  }
+  else
+  {
+    pose_handle_.setPose(setpoint.pose);
+  }
+}
+
+void CartesianTrajectoryController::holdPose(const geometry_msgs::Pose& pose)
+{
+  hold_ = CartesianState();
+  hold_.pose = pose;
+}
+
+bool CartesianTrajectoryController::resolvePosture(const cartesian_control_msgs::CartesianTrajectory& trajectory,
+                                                   PostureSchedule& posture, std::string& error) const
+{
+  posture = PostureSchedule();
+
+  bool has_postures = false;
+  for (const cartesian_control_msgs::CartesianTrajectoryPoint& point : trajectory.points)
+  {
+    if (point.posture.posture_joint_names.size() != point.posture.posture_joint_values.size())
+    {
+      error = "Posture joint names and values differ in size.";
+      return false;
+    }
+    has_postures = has_postures || !point.posture.posture_joint_names.empty();
+  }
+
+  if (!has_postures)
+  {
+    return true;
+  }
+  if (!has_posture_)
+  {
+    ROS_WARN_STREAM("Ignoring the trajectory's postures. The robot provides no PostureCommandInterface for '"
+                    << state_handle_.getName() << "'.");
+    return true;
+  }
+
+  posture.times.reserve(trajectory.points.size());
+  posture.offsets.reserve(trajectory.points.size() + 1);
+  posture.offsets.push_back(0);
+  for (const cartesian_control_msgs::CartesianTrajectoryPoint& point : trajectory.points)
+  {
+    posture.times.push_back(point.time_from_start.toSec());
+    for (size_t i = 0; i < point.posture.posture_joint_names.size(); ++i)
+    {
+      const int index = posture_handle_.index(point.posture.posture_joint_names[i]);
+      if (index < 0)
+      {
+        error = "Unknown posture joint '" + point.posture.posture_joint_names[i] + "'.";
+        return false;
+      }
+      posture.indices.push_back(index);
+      posture.values.push_back(point.posture.posture_joint_values[i]);
+    }
+    posture.offsets.push_back(posture.indices.size());
+  }
+  return true;
+}
+
+void CartesianTrajectoryController::writeFeedback(const ros::Time& time, double trajectory_time,
+                                                  const CartesianState& actual)
+{
+  // Only values are written. The strings were set when the goal arrived.
+  Feedback& feedback = rt_goal_->feedback.getWriteBuffer();
+  const ros::Duration time_from_start(trajectory_time);
+  feedback.header.stamp = time;
+  toPoint(desired_, time_from_start, feedback.desired);
+  toPoint(actual, time_from_start, feedback.actual);
+
+  cartesian_control_msgs::CartesianTrajectoryPoint& error = feedback.error;
+  error.time_from_start = time_from_start;
+  Eigen::Map<Eigen::Vector3d>(&error.pose.position.x) = Eigen::Map<const Eigen::Vector3d>(&desired_.pose.position.x) -
+                                                        Eigen::Map<const Eigen::Vector3d>(&actual.pose.position.x);
+  Eigen::Map<Eigen::Quaterniond>(&error.pose.orientation.x) =
+      Eigen::Map<const Eigen::Quaterniond>(&desired_.pose.orientation.x) *
+      Eigen::Map<const Eigen::Quaterniond>(&actual.pose.orientation.x).inverse();
+  subtract(desired_.twist.linear, actual.twist.linear, error.twist.linear);
+  subtract(desired_.twist.angular, actual.twist.angular, error.twist.angular);
+  subtract(desired_.accel.linear, actual.accel.linear, error.acceleration.linear);
+  subtract(desired_.accel.angular, actual.accel.angular, error.acceleration.angular);
+  subtract(desired_.jerk.linear, actual.jerk.linear, error.jerk.linear);
+  subtract(desired_.jerk.angular, actual.jerk.angular, error.jerk.angular);
+
+  rt_goal_->feedback.publish();
+}
+
+void CartesianTrajectoryController::writePosture(double time)
+{
+  if (!has_posture_ || rt_goal_->posture.times.empty())
+  {
+    return;
+  }
+
+  // Command the posture of the waypoint we are moving towards
+  const PostureSchedule& posture = rt_goal_->posture;
+  size_t waypoint = (rt_posture_waypoint_ < posture.times.size()) ? rt_posture_waypoint_ : 0;
+  while (waypoint + 1 < posture.times.size() && time > posture.times[waypoint])
+  {
+    ++waypoint;
+  }
+  if (waypoint == rt_posture_waypoint_)
+  {
+    return;
+  }
+
+  rt_posture_waypoint_ = waypoint;
+  posture_handle_.clearPosture();
+  for (size_t i = posture.offsets[waypoint]; i < posture.offsets[waypoint + 1]; ++i)
+  {
+    posture_handle_.setPosture(posture.indices[i], posture.values[i]);
+  }
+}
+
+}  // namespace cartesian_ros_control
+
+PLUGINLIB_EXPORT_CLASS(cartesian_ros_control::CartesianTrajectoryController, controller_interface::ControllerBase)
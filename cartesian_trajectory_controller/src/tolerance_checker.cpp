@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <cartesian_trajectory_controller/tolerance_checker.h>
+
+#include <limits>
+
+#include <Eigen/Geometry>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+double toLimit(double tolerance)
+{
+  // Zero tolerances are not checked
+  return tolerance > 0.0 ? tolerance : std::numeric_limits<double>::infinity();
+}
+
+void packLimits(const geometry_msgs::Vector3& tolerance, ToleranceChecker::Components& limits, int offset)
+{
+  limits[offset] = toLimit(tolerance.x);
+  limits[offset + 1] = toLimit(tolerance.y);
+  limits[offset + 2] = toLimit(tolerance.z);
+}
+
+Eigen::Map<const Eigen::Vector3d> map(const geometry_msgs::Vector3& vector)
+{
+  return Eigen::Map<const Eigen::Vector3d>(&vector.x);
+}
+}  // namespace
+
+ToleranceChecker::ToleranceChecker()
+  : limits_(Components::Constant(std::numeric_limits<double>::infinity())), errors_(Components::Zero())
+{
+}
+
+void ToleranceChecker::init(const cartesian_control_msgs::CartesianTolerance& tolerance)
+{
+  packLimits(tolerance.position_error, limits_, POSITION_X);
+  packLimits(tolerance.orientation_error, limits_, ORIENTATION_X);
+  packLimits(tolerance.twist_error.linear, limits_, TWIST_LINEAR_X);
+  packLimits(tolerance.twist_error.angular, limits_, TWIST_ANGULAR_X);
+  packLimits(tolerance.acceleration_error.linear, limits_, ACCEL_LINEAR_X);
+  packLimits(tolerance.acceleration_error.angular, limits_, ACCEL_ANGULAR_X);
+  errors_.setZero();
+}
+
+int ToleranceChecker::check(const CartesianState& desired, const CartesianState& actual)
+{
+  errors_.segment<3>(POSITION_X) = Eigen::Map<const Eigen::Vector3d>(&desired.pose.position.x) -
+                                   Eigen::Map<const Eigen::Vector3d>(&actual.pose.position.x);
+
+  const Eigen::AngleAxisd rotation(Eigen::Map<const Eigen::Quaterniond>(&desired.pose.orientation.x) *
+                                   Eigen::Map<const Eigen::Quaterniond>(&actual.pose.orientation.x).inverse());
+  errors_.segment<3>(ORIENTATION_X) = rotation.axis() * rotation.angle();
+
+  errors_.segment<3>(TWIST_LINEAR_X) = map(desired.twist.linear) - map(actual.twist.linear);
+  errors_.segment<3>(TWIST_ANGULAR_X) = map(desired.twist.angular) - map(actual.twist.angular);
+  errors_.segment<3>(ACCEL_LINEAR_X) = map(desired.accel.linear) - map(actual.accel.linear);
+  errors_.segment<3>(ACCEL_ANGULAR_X) = map(desired.accel.angular) - map(actual.accel.angular);
+
+  // One pass over all components. Infinite limits never win, and NaN
+  // errors fail the comparison.
+  if ((errors_.abs() <= limits_).all())
+  {
+    return -1;
+  }
+
+  for (int i = 0; i < NUM_COMPONENTS; ++i)
+  {
+    if (limits_[i] < std::numeric_limits<double>::infinity() && !(std::abs(errors_[i]) <= limits_[i]))
+    {
+      return i;
+    }
+  }
+  return -1;  // Only NaN errors of unchecked components end up here
+}
+
+const char* ToleranceChecker::getComponentName(int component)
+{
+  static const char* const names[NUM_COMPONENTS] = {
+    "position error in x",
+    "position error in y",
+    "position error in z",
+    "orientation error in x",
+    "orientation error in y",
+    "orientation error in z",
+    "linear twist error in x",
+    "linear twist error in y",
+    "linear twist error in z",
+    "angular twist error in x",
+    "angular twist error in y",
+    "angular twist error in z",
+    "linear acceleration error in x",
+    "linear acceleration error in y",
+    "linear acceleration error in z",
+    "angular acceleration error in x",
+    "angular acceleration error in y",
+    "angular acceleration error in z"
+  };
+  return (component >= 0 && component < NUM_COMPONENTS) ? names[component] : "no error";
+}
+
+}  // namespace cartesian_ros_control
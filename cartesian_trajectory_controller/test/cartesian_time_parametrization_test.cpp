@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <Eigen/Geometry>
+
+#include <cartesian_trajectory_controller/cartesian_time_parametrization.h>
+#include <cartesian_trajectory_controller/cartesian_trajectory.h>
+
+using namespace cartesian_ros_control;
+
+class CartesianTimeParametrizationTest : public ::testing::Test
+{
+protected:
+  typedef CartesianTimeParametrization::Vector6d Vector6d;
+
+  void addPoint(double x, double y, double z, const Eigen::Quaterniond& q = Eigen::Quaterniond::Identity())
+  {
+    cartesian_control_msgs::CartesianTrajectoryPoint point;
+    point.pose.position.x = x;
+    point.pose.position.y = y;
+    point.pose.position.z = z;
+    point.pose.orientation.x = q.x();
+    point.pose.orientation.y = q.y();
+    point.pose.orientation.z = q.z();
+    point.pose.orientation.w = q.w();
+    msg.points.push_back(point);
+  }
+
+  Vector6d toVector(const geometry_msgs::Vector3& linear, const geometry_msgs::Vector3& angular)
+  {
+    Vector6d v;
+    v << linear.x, linear.y, linear.z, angular.x, angular.y, angular.z;
+    return v;
+  }
+
+  /**
+   * @brief Check monotonic times and the limits at all waypoints
+   */
+  void expectWithinLimits(const Vector6d& velocity, const Vector6d& acceleration, const Vector6d& jerk)
+  {
+    ASSERT_FALSE(msg.points.empty());
+    EXPECT_DOUBLE_EQ(0.0, msg.points.front().time_from_start.toSec());
+    for (size_t i = 0; i < msg.points.size(); ++i)
+    {
+      const cartesian_control_msgs::CartesianTrajectoryPoint& point = msg.points[i];
+      if (i > 0)
+      {
+        EXPECT_GT(point.time_from_start.toSec(), msg.points[i - 1].time_from_start.toSec());
+      }
+      const Vector6d v = toVector(point.twist.linear, point.twist.angular);
+      const Vector6d a = toVector(point.acceleration.linear, point.acceleration.angular);
+      const Vector6d j = toVector(point.jerk.linear, point.jerk.angular);
+      for (int k = 0; k < 6; ++k)
+      {
+        if (velocity[k] > 0.0)
+        {
+          EXPECT_LE(std::abs(v[k]), velocity[k] * (1 + 1e-6)) << "waypoint " << i << ", axis " << k;
+        }
+        if (acceleration[k] > 0.0)
+        {
+          EXPECT_LE(std::abs(a[k]), acceleration[k] * (1 + 1e-6)) << "waypoint " << i << ", axis " << k;
+        }
+        if (jerk[k] > 0.0)
+        {
+          EXPECT_LE(std::abs(j[k]), jerk[k] * (1 + 1e-5)) << "waypoint " << i << ", axis " << k;
+        }
+      }
+    }
+  }
+
+  cartesian_control_msgs::CartesianTrajectory msg;
+  CartesianTimeParametrization retimer;
+  std::string error;
+};
+
+TEST_F(CartesianTimeParametrizationTest, TestRejectInvalidInput)
+{
+  addPoint(0, 0, 0);
+  addPoint(1, 0, 0);
+  EXPECT_FALSE(retimer.retime(msg, error));
+
+  EXPECT_FALSE(retimer.setLimits(Vector6d::Zero(), Vector6d::Zero(), Vector6d::Ones(), error));
+  EXPECT_FALSE(retimer.setLimits(-Vector6d::Ones(), Vector6d::Ones(), Vector6d::Zero(), error));
+  ASSERT_TRUE(retimer.setLimits(Vector6d::Ones(), Vector6d::Ones(), Vector6d::Zero(), error));
+
+  msg.points.pop_back();
+  EXPECT_FALSE(retimer.retime(msg, error));
+}
+
+TEST_F(CartesianTimeParametrizationTest, TestTrapezoidalProfileOnStraightLine)
+{
+  for (int i = 0; i <= 1000; ++i)
+  {
+    addPoint(i / 1000.0, 0, 0);
+  }
+
+  Vector6d velocity = Vector6d::Constant(0.5);
+  Vector6d acceleration = Vector6d::Constant(1.0);
+  ASSERT_TRUE(retimer.setLimits(velocity, acceleration, Vector6d::Zero(), error)) << error;
+  ASSERT_TRUE(retimer.retime(msg, error)) << error;
+  expectWithinLimits(velocity, acceleration, Vector6d::Zero());
+
+  // 0.5 s for accelerating and decelerating each, 1.5 s at full speed
+  EXPECT_NEAR(2.5, msg.points.back().time_from_start.toSec(), 0.01);
+  EXPECT_NEAR(0.5, msg.points[500].twist.linear.x, 1e-6);
+  EXPECT_NEAR(0.0, msg.points.back().twist.linear.x, 1e-6);
+}
+
+TEST_F(CartesianTimeParametrizationTest, TestTwoWaypoints)
+{
+  addPoint(0, 0, 0);
+  addPoint(1, 0, 0);
+
+  Vector6d velocity = Vector6d::Constant(0.5);
+  Vector6d acceleration = Vector6d::Constant(1.0);
+  ASSERT_TRUE(retimer.setLimits(velocity, acceleration, Vector6d::Zero(), error)) << error;
+  ASSERT_TRUE(retimer.retime(msg, error)) << error;
+  expectWithinLimits(velocity, acceleration, Vector6d::Zero());
+  EXPECT_NEAR(2.5, msg.points.back().time_from_start.toSec(), 0.01);
+
+  Vector6d jerk = Vector6d::Constant(5.0);
+  ASSERT_TRUE(retimer.setLimits(velocity, acceleration, jerk, error)) << error;
+  ASSERT_TRUE(retimer.retime(msg, error)) << error;
+  expectWithinLimits(velocity, acceleration, jerk);
+  EXPECT_NEAR(2.7, msg.points.back().time_from_start.toSec(), 0.01);
+}
+
+TEST_F(CartesianTimeParametrizationTest, TestAngularLimits)
+{
+  for (int i = 0; i <= 100; ++i)
+  {
+    addPoint(0, 0, 0, Eigen::Quaterniond(Eigen::AngleAxisd(i * 0.01, Eigen::Vector3d::UnitZ())));
+  }
+
+  Vector6d velocity;
+  velocity << 1, 1, 1, 0.25, 0.25, 0.25;
+  Vector6d acceleration;
+  acceleration << 1, 1, 1, 0.5, 0.5, 0.5;
+  ASSERT_TRUE(retimer.setLimits(velocity, acceleration, Vector6d::Zero(), error)) << error;
+  ASSERT_TRUE(retimer.retime(msg, error)) << error;
+  expectWithinLimits(velocity, acceleration, Vector6d::Zero());
+
+  // 1 rad: 0.5 s for accelerating and decelerating each, 3.5 s at full speed
+  EXPECT_NEAR(4.5, msg.points.back().time_from_start.toSec(), 0.05);
+  EXPECT_NEAR(0.25, msg.points[50].twist.angular.z, 1e-6);
+}
+
+TEST_F(CartesianTimeParametrizationTest, TestJerkLimits)
+{
+  for (int i = 0; i <= 200; ++i)
+  {
+    const double angle = i * M_PI / 200;
+    addPoint(std::cos(angle), std::sin(angle), 0);
+  }
+
+  Vector6d velocity = Vector6d::Constant(0.5);
+  Vector6d acceleration = Vector6d::Constant(1.0);
+  Vector6d jerk = Vector6d::Constant(5.0);
+  ASSERT_TRUE(retimer.setLimits(velocity, acceleration, Vector6d::Zero(), error)) << error;
+  ASSERT_TRUE(retimer.retime(msg, error)) << error;
+  const double unlimited_duration = msg.points.back().time_from_start.toSec();
+
+  ASSERT_TRUE(retimer.setLimits(velocity, acceleration, jerk, error)) << error;
+  ASSERT_TRUE(retimer.retime(msg, error)) << error;
+  expectWithinLimits(velocity, acceleration, jerk);
+  EXPECT_GT(msg.points.back().time_from_start.toSec(), unlimited_duration);
+}
+
+TEST_F(CartesianTimeParametrizationTest, TestJerkLimitsOnDenseStraightLines)
+{
+  Vector6d velocity = Vector6d::Constant(0.5);
+  Vector6d acceleration = Vector6d::Constant(1.0);
+  for (int waypoints : { 5000, 10000 })
+  {
+    for (double max_jerk : { 5.0, 50.0 })
+    {
+      msg.points.clear();
+      for (int i = 0; i < waypoints; ++i)
+      {
+        addPoint(i / (waypoints - 1.0), 0, 0);
+      }
+
+      Vector6d jerk = Vector6d::Constant(max_jerk);
+      ASSERT_TRUE(retimer.setLimits(velocity, acceleration, jerk, error)) << error;
+      ASSERT_TRUE(retimer.retime(msg, error)) << waypoints << " waypoints, jerk " << max_jerk << ": " << error;
+      expectWithinLimits(velocity, acceleration, jerk);
+
+      // S-curve over 1 m: 1 m / v + v / a + a / j
+      EXPECT_NEAR(2.5 + 1.0 / max_jerk, msg.points.back().time_from_start.toSec(), 0.01)
+          << waypoints << " waypoints, jerk " << max_jerk;
+    }
+  }
+}
+
+TEST_F(CartesianTimeParametrizationTest, TestResultIsAValidTrajectory)
+{
+  for (int i = 0; i < 10000; ++i)
+  {
+    addPoint(0.3 * std::sin(i * 0.001), 0.2 * std::cos(i * 0.002), 0.001 * i,
+             Eigen::Quaterniond(Eigen::AngleAxisd(i * 1e-4, Eigen::Vector3d::UnitX())));
+  }
+
+  Vector6d velocity = Vector6d::Constant(0.5);
+  Vector6d acceleration = Vector6d::Constant(2.0);
+  ASSERT_TRUE(retimer.setLimits(velocity, acceleration, Vector6d::Zero(), error)) << error;
+  ASSERT_TRUE(retimer.retime(msg, error)) << error;
+  expectWithinLimits(velocity, acceleration, Vector6d::Zero());
+
+  CartesianState start;
+  start.pose = msg.points.front().pose;
+  CartesianTrajectory trajectory;
+  EXPECT_TRUE(trajectory.init(msg, start, error)) << error;
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include <cartesian_trajectory_controller/cartesian_trajectory.h>
+
+using namespace cartesian_ros_control;
+
+class CartesianTrajectoryTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    start_state.pose.orientation.w = 1.0;
+  }
+
+  void addPoint(double time, double x, double y, double z, const Eigen::Quaterniond& q = Eigen::Quaterniond::Identity())
+  {
+    cartesian_control_msgs::CartesianTrajectoryPoint point;
+    point.time_from_start = ros::Duration(time);
+    point.pose.position.x = x;
+    point.pose.position.y = y;
+    point.pose.position.z = z;
+    point.pose.orientation.x = q.x();
+    point.pose.orientation.y = q.y();
+    point.pose.orientation.z = q.z();
+    point.pose.orientation.w = q.w();
+    msg.points.push_back(point);
+  }
+
+  cartesian_control_msgs::CartesianTrajectory msg;
+  CartesianState start_state;
+  CartesianTrajectory trajectory;
+  std::string error;
+};
+
+TEST_F(CartesianTrajectoryTest, TestRejectInvalidTrajectories)
+{
+  EXPECT_FALSE(trajectory.init(msg, start_state, error));
+  EXPECT_TRUE(trajectory.empty());
+
+  addPoint(1.0, 0, 0, 0);
+  addPoint(1.0, 1, 0, 0);
+  EXPECT_FALSE(trajectory.init(msg, start_state, error));
+  EXPECT_TRUE(trajectory.empty());
+
+  msg.points.clear();
+  addPoint(1.0, 0, 0, 0);
+  msg.points.back().pose.orientation.w = 0.5;
+  EXPECT_FALSE(trajectory.init(msg, start_state, error));
+  EXPECT_TRUE(trajectory.empty());
+}
+
+TEST_F(CartesianTrajectoryTest, TestRejectNonFiniteWaypoints)
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+  addPoint(1.0, 0, 0, 0);
+  addPoint(2.0, 1, 0, 0);
+  ASSERT_TRUE(trajectory.init(msg, start_state, error));
+
+  cartesian_control_msgs::CartesianTrajectoryPoint& point = msg.points[1];
+  for (double* value : { &point.pose.position.y, &point.pose.orientation.x, &point.twist.linear.x,
+                         &point.twist.angular.z, &point.acceleration.linear.z, &point.acceleration.angular.y })
+  {
+    for (const double invalid : { nan, inf })
+    {
+      const double original = *value;
+      *value = invalid;
+      EXPECT_FALSE(trajectory.init(msg, start_state, error));
+      EXPECT_EQ("Waypoint 1 has non-finite values.", error);
+      EXPECT_TRUE(trajectory.empty());
+      *value = original;
+    }
+  }
+}
+
+TEST_F(CartesianTrajectoryTest, TestStartFromCurrentState)
+{
+  start_state.pose.position.x = -1.0;
+  addPoint(1.0, 1, 0, 0);
+  addPoint(2.0, 1, 2, 0);
+  ASSERT_TRUE(trajectory.init(msg, start_state, error));
+  EXPECT_DOUBLE_EQ(2.0, trajectory.getDuration());
+
+  CartesianState state;
+  trajectory.sample(0.0, state);
+  EXPECT_DOUBLE_EQ(-1.0, state.pose.position.x);
+  EXPECT_DOUBLE_EQ(0.0, state.twist.linear.x);
+
+  // Quintic rest-to-rest segments peak at 15/8 of the mean velocity halfway through.
+  trajectory.sample(0.5, state);
+  EXPECT_NEAR(0.0, state.pose.position.x, 1e-9);
+  EXPECT_NEAR(15.0 / 8.0 * 2.0, state.twist.linear.x, 1e-9);
+  EXPECT_NEAR(0.0, state.accel.linear.x, 1e-9);
+
+  trajectory.sample(1.5, state);
+  EXPECT_NEAR(1.0, state.pose.position.x, 1e-9);
+  EXPECT_NEAR(1.0, state.pose.position.y, 1e-9);
+  EXPECT_NEAR(15.0 / 8.0 * 2.0, state.twist.linear.y, 1e-9);
+
+  trajectory.sample(3.0, state);
+  EXPECT_DOUBLE_EQ(2.0, state.pose.position.y);
+  EXPECT_DOUBLE_EQ(0.0, state.twist.linear.y);
+}
+
+TEST_F(CartesianTrajectoryTest, TestOrientationInterpolation)
+{
+  const Eigen::Quaterniond target(Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitZ()));
+  addPoint(2.0, 0, 0, 0, target);
+  ASSERT_TRUE(trajectory.init(msg, start_state, error));
+
+  CartesianState state;
+  trajectory.sample(1.0, state);
+  const Eigen::Quaterniond halfway(Eigen::AngleAxisd(M_PI / 4, Eigen::Vector3d::UnitZ()));
+  EXPECT_NEAR(1.0, std::abs(halfway.dot(Eigen::Map<const Eigen::Quaterniond>(&state.pose.orientation.x))), 1e-9);
+  EXPECT_NEAR(15.0 / 8.0 * M_PI / 4, state.twist.angular.z, 1e-9);
+  EXPECT_NEAR(0.0, state.twist.angular.x, 1e-9);
+}
+
+TEST_F(CartesianTrajectoryTest, TestBoundaryConditions)
+{
+  const Eigen::Quaterniond q1(Eigen::AngleAxisd(0.5, Eigen::Vector3d(1, 2, 3).normalized()));
+  const Eigen::Quaterniond q2(Eigen::AngleAxisd(1.5, Eigen::Vector3d(-1, 0, 1).normalized()));
+  addPoint(1.0, 1, 0, 0, q1);
+  msg.points.back().twist.linear.x = 0.5;
+  msg.points.back().twist.angular.y = 0.3;
+  msg.points.back().acceleration.linear.z = -1.0;
+  msg.points.back().acceleration.angular.x = 0.2;
+  addPoint(2.5, 2, 1, 0, q2);
+  ASSERT_TRUE(trajectory.init(msg, start_state, error));
+
+  // Sample slightly before and after the inner waypoint. Both sides must agree with it.
+  for (double time : { 1.0 - 1e-7, 1.0 + 1e-7 })
+  {
+    CartesianState state;
+    trajectory.sample(time, state);
+    EXPECT_NEAR(1.0, state.pose.position.x, 1e-6);
+    EXPECT_NEAR(1.0, std::abs(q1.dot(Eigen::Map<const Eigen::Quaterniond>(&state.pose.orientation.x))), 1e-9);
+    EXPECT_NEAR(0.5, state.twist.linear.x, 1e-5);
+    EXPECT_NEAR(0.0, state.twist.angular.x, 1e-5);
+    EXPECT_NEAR(0.3, state.twist.angular.y, 1e-5);
+    EXPECT_NEAR(0.0, state.twist.angular.z, 1e-5);
+    EXPECT_NEAR(-1.0, state.accel.linear.z, 1e-4);
+    EXPECT_NEAR(0.2, state.accel.angular.x, 1e-4);
+  }
+
+  CartesianState state;
+  trajectory.sample(2.5 - 1e-9, state);
+  EXPECT_NEAR(1.0, std::abs(q2.dot(Eigen::Map<const Eigen::Quaterniond>(&state.pose.orientation.x))), 1e-9);
+  EXPECT_NEAR(0.0, state.twist.angular.x, 1e-6);
+}
+
+TEST_F(CartesianTrajectoryTest, TestSamplingOrderDoesNotMatter)
+{
+  for (int i = 1; i <= 100; ++i)
+  {
+    addPoint(0.1 * i, std::sin(0.1 * i), std::cos(0.1 * i), 0.01 * i);
+  }
+  ASSERT_TRUE(trajectory.init(msg, start_state, error));
+
+  CartesianTrajectory reference = trajectory;
+  CartesianState state;
+  CartesianState expected;
+  for (double time : { 0.05, 0.07, 0.15, 9.3, 2.0, 2.01, 0.0, 5.55, 10.5 })
+  {
+    trajectory.sample(time, state);
+
+    // A fresh copy always searches from the start.
+    CartesianTrajectory fresh = reference;
+    fresh.sample(time, expected);
+    EXPECT_DOUBLE_EQ(expected.pose.position.x, state.pose.position.x) << "time: " << time;
+    EXPECT_DOUBLE_EQ(expected.twist.linear.y, state.twist.linear.y) << "time: " << time;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include <cartesian_trajectory_controller/tolerance_checker.h>
+
+using namespace cartesian_ros_control;
+
+class ToleranceCheckerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    desired.pose.orientation.w = 1.0;
+    actual.pose.orientation.w = 1.0;
+  }
+
+  CartesianState desired;
+  CartesianState actual;
+  cartesian_control_msgs::CartesianTolerance tolerance;
+};
+
+TEST_F(ToleranceCheckerTest, TestZeroTolerancesAreNotChecked)
+{
+  ToleranceChecker unlimited;
+  actual.pose.position.x = 100.0;
+  actual.twist.angular.z = 100.0;
+  EXPECT_EQ(-1, unlimited.check(desired, actual));
+
+  ToleranceChecker checker(tolerance);
+  EXPECT_EQ(-1, checker.check(desired, actual));
+  EXPECT_DOUBLE_EQ(-100.0, checker.getErrors()[ToleranceChecker::POSITION_X]);
+}
+
+TEST_F(ToleranceCheckerTest, TestFirstViolatedComponent)
+{
+  tolerance.position_error.z = 0.01;
+  tolerance.twist_error.linear.y = 0.1;
+  tolerance.acceleration_error.angular.x = 1.0;
+  ToleranceChecker checker(tolerance);
+
+  actual.pose.position.z = 0.005;
+  actual.twist.linear.y = -0.05;
+  EXPECT_EQ(-1, checker.check(desired, actual));
+
+  actual.accel.angular.x = 2.0;
+  EXPECT_EQ(ToleranceChecker::ACCEL_ANGULAR_X, checker.check(desired, actual));
+
+  // Violations are reported in component order
+  actual.twist.linear.y = 0.2;
+  EXPECT_EQ(ToleranceChecker::TWIST_LINEAR_X + 1, checker.check(desired, actual));
+  EXPECT_STREQ("linear twist error in y", ToleranceChecker::getComponentName(ToleranceChecker::TWIST_LINEAR_X + 1));
+
+  actual.pose.position.z = -0.02;
+  EXPECT_EQ(ToleranceChecker::POSITION_X + 2, checker.check(desired, actual));
+}
+
+TEST_F(ToleranceCheckerTest, TestOrientationError)
+{
+  tolerance.orientation_error.z = 0.1;
+  ToleranceChecker checker(tolerance);
+
+  // 0.05 rad about z
+  actual.pose.orientation.z = std::sin(-0.025);
+  actual.pose.orientation.w = std::cos(-0.025);
+  EXPECT_EQ(-1, checker.check(desired, actual));
+  EXPECT_NEAR(0.05, checker.getErrors()[ToleranceChecker::ORIENTATION_X + 2], 1e-9);
+
+  actual.pose.orientation.z = std::sin(-0.1);
+  actual.pose.orientation.w = std::cos(-0.1);
+  EXPECT_EQ(ToleranceChecker::ORIENTATION_X + 2, checker.check(desired, actual));
+}
+
+TEST_F(ToleranceCheckerTest, TestNonFiniteErrorsViolate)
+{
+  tolerance.position_error.y = 0.01;
+  tolerance.twist_error.angular.x = 0.1;
+  ToleranceChecker checker(tolerance);
+
+  // Unchecked components stay unchecked
+  actual.accel.linear.z = std::nan("");
+  EXPECT_EQ(-1, checker.check(desired, actual));
+
+  actual.twist.angular.x = std::numeric_limits<double>::infinity();
+  EXPECT_EQ(ToleranceChecker::TWIST_ANGULAR_X, checker.check(desired, actual));
+
+  actual.pose.position.y = std::nan("");
+  EXPECT_EQ(ToleranceChecker::POSITION_X + 1, checker.check(desired, actual));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include <controller_interface/controller.h>
+#include <geometry_msgs/PoseStamped.h>
+#include <realtime_tools/realtime_buffer.h>
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+
+#include <cartesian_interface/cartesian_command_interface.h>
+#include <pose_streaming_controller/pose_trajectory_generator.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A Cartesian ROS-controller for streaming target poses to a robot
+ *
+ * This controller follows target poses that arrive on \a command at a
+ * rate of its own, e.g. from a vision pipeline at 30 to 100 Hz. In every
+ * update(), a PoseTrajectoryGenerator moves the setpoint towards the
+ * latest target within the per-axis limits from the \a max_velocity,
+ * \a max_acceleration and \a max_jerk parameters. The resulting smooth
+ * setpoints are written to a PoseCommandHandle at the full control rate,
+ * so that new targets never reach the drives as steps.
+ *
+ * Targets are expressed in the handle's reference frame if their header's
+ * frame_id is empty or that frame. Other frames must be fixed with
+ * respect to the reference frame and are resolved via tf on arrival.
+ *
+ * Without new targets, the controller comes to rest at the latest one. On
+ * start, it holds the current pose.
+ */
+class PoseStreamingController : public controller_interface::Controller<PoseCommandInterface>
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /**
+   * @brief A target pose in the handle's reference frame
+   */
+  struct PoseTarget
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    Eigen::Vector3d position = { Eigen::Vector3d::Zero() };
+    Eigen::Quaterniond orientation = { Eigen::Quaterniond::Identity() };
+  };
+
+  PoseStreamingController() = default;
+  virtual ~PoseStreamingController() = default;
+
+  virtual bool init(PoseCommandInterface* hw, ros::NodeHandle& n) override;
+
+  virtual void starting(const ros::Time& time) override;
+
+  virtual void update(const ros::Time& time, const ros::Duration& period) override;
+
+  PoseCommandHandle handle_;
+  realtime_tools::RealtimeBuffer<PoseTarget> target_buffer_;
+
+protected:
+  void poseCallback(const geometry_msgs::PoseStampedConstPtr& msg);
+
+private:
+  PoseTrajectoryGenerator generator_;
+  geometry_msgs::Pose pose_;
+
+  ros::Subscriber pose_sub_;
+  std::unique_ptr<tf2_ros::Buffer> tf_buffer_;
+  std::unique_ptr<tf2_ros::TransformListener> tf_listener_;
+};
+
+}  // namespace cartesian_ros_control
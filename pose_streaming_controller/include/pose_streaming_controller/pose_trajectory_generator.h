@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Geometry>
+
+#include <cartesian_interface/twist_limits.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Online generation of jerk-limited motion towards streamed target poses
+ *
+ * Each call to update() advances a pose setpoint by one control cycle
+ * towards the latest target, within per-axis velocity, acceleration and
+ * jerk limits. Targets may jump arbitrarily between calls, so low-rate
+ * target streams, e.g. from vision at 30 Hz, turn into smooth setpoints at
+ * the full control rate.
+ *
+ * Every axis first predicts where it would come to rest if it ramped its
+ * acceleration down to zero right away. From the remaining distance, it
+ * derives the fastest velocity that still allows stopping at the target
+ * within the acceleration and jerk limits, and ramps its acceleration
+ * towards that velocity with the same braking curve as TwistLimiter, so
+ * the jerk limit holds even where the velocity limit cuts in. Orientations
+ * are handled as rotation vectors in the reference frame.
+ *
+ * Unlike a full Ruckig-style generator, this doesn't compute time-optimal
+ * profiles to targets in motion, and axes are not synchronized to arrive
+ * at the same time. It is cheap enough to run in every cycle, though.
+ *
+ * update() neither allocates nor blocks and is safe to call in real-time.
+ */
+class PoseTrajectoryGenerator
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  PoseTrajectoryGenerator() = default;
+
+  void setLimits(const TwistLimits& limits)
+  {
+    limits_ = limits;
+  }
+
+  const TwistLimits& getLimits() const
+  {
+    return limits_;
+  }
+
+  /**
+   * @brief Restart at rest in the given pose
+   */
+  void reset(const Eigen::Vector3d& position, const Eigen::Quaterniond& orientation);
+
+  /**
+   * @brief Advance the setpoint by \a period seconds towards the target pose
+   */
+  void update(const Eigen::Vector3d& target_position, const Eigen::Quaterniond& target_orientation, double period);
+
+  const Eigen::Vector3d& getPosition() const
+  {
+    return position_;
+  }
+
+  const Eigen::Quaterniond& getOrientation() const
+  {
+    return orientation_;
+  }
+
+  const Vector6d& getTwist() const
+  {
+    return twist_;
+  }
+
+  const Vector6d& getAccel() const
+  {
+    return accel_;
+  }
+
+private:
+  TwistLimits limits_;
+  Vector6d twist_ = { Vector6d::Zero() };
+  Vector6d accel_ = { Vector6d::Zero() };
+  Eigen::Vector3d position_ = { Eigen::Vector3d::Zero() };
+  Eigen::Quaterniond orientation_ = { Eigen::Quaterniond::Identity() };
+};
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <pose_streaming_controller/pose_streaming_controller.h>
+#include <pluginlib/class_list_macros.hpp>
+
+namespace cartesian_ros_control
+{
+bool PoseStreamingController::init(PoseCommandInterface* hw, ros::NodeHandle& n)
+{
+  std::string frame_id;
+  if (!n.getParam("frame_id", frame_id))
+  {
+    ROS_ERROR_STREAM("Required parameter " << n.resolveName("frame_id") << " not given");
+    return false;
+  }
+
+  handle_ = hw->getHandle(frame_id);
+  tf_buffer_.reset(new tf2_ros::Buffer());
+  tf_listener_.reset(new tf2_ros::TransformListener(*tf_buffer_));
+
+  std::vector<std::string> joint_names;
+  if (!n.getParam("joints", joint_names))
+  {
+    ROS_ERROR_STREAM("Failed to read required parameter '" << n.resolveName("joints") << ".");
+    return false;
+  }
+
+  for (auto& name : joint_names)
+  {
+    hw->claim(name);
+  }
+
+  TwistLimits limits;
+  if (!readTwistLimits(n, limits))
+  {
+    return false;
+  }
+  if ((limits.velocity.array() == 0.0).all() && (limits.acceleration.array() == 0.0).all() &&
+      (limits.jerk.array() == 0.0).all())
+  {
+    ROS_WARN_STREAM("No limits given in " << n.getNamespace() << ". Targets will be passed through unchanged.");
+  }
+  generator_.setLimits(limits);
+
+  pose_sub_ = n.subscribe<geometry_msgs::PoseStamped>("command", 1, &PoseStreamingController::poseCallback, this);
+  return true;
+}
+
+void PoseStreamingController::starting(const ros::Time& /*time*/)
+{
+  // Hold the current pose until the first target arrives
+  PoseTarget target;
+  target.position = handle_.getPositionMap();
+  target.orientation = handle_.getOrientationMap();
+  target_buffer_.initRT(target);
+  generator_.reset(target.position, target.orientation);
+}
+
+void PoseStreamingController::update(const ros::Time& /*time*/, const ros::Duration& period)
+{
+  const PoseTarget& target = *target_buffer_.readFromRT();
+  generator_.update(target.position, target.orientation, period.toSec());
+
+  const Eigen::Vector3d& position = generator_.getPosition();
+  const Eigen::Quaterniond& orientation = generator_.getOrientation();
+  pose_.position.x = position.x();
+  pose_.position.y = position.y();
+  pose_.position.z = position.z();
+  pose_.orientation.x = orientation.x();
+  pose_.orientation.y = orientation.y();
+  pose_.orientation.z = orientation.z();
+  pose_.orientation.w = orientation.w();
+  handle_.setPose(pose_);
+}
+
+void PoseStreamingController::poseCallback(const geometry_msgs::PoseStampedConstPtr& msg)
+{
+  const geometry_msgs::Pose& pose = msg->pose;
+  PoseTarget target;
+  target.position << pose.position.x, pose.position.y, pose.position.z;
+  target.orientation =
+      Eigen::Quaterniond(pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+  if (!target.position.allFinite() || !target.orientation.coeffs().allFinite())
+  {
+    // NaN would pass the norm check below and poison the generator for good
+    ROS_ERROR_STREAM("Dropping pose target with non-finite values.");
+    return;
+  }
+  if (target.orientation.norm() < 1e-6)
+  {
+    ROS_ERROR_STREAM("Dropping pose target with invalid orientation.");
+    return;
+  }
+  target.orientation.normalize();
+
+  const std::string& frame = msg->header.frame_id;
+  if (!frame.empty() && frame != handle_.getReferenceFrame())
+  {
+    geometry_msgs::TransformStamped transform;
+    try
+    {
+      transform = tf_buffer_->lookupTransform(handle_.getReferenceFrame(), frame, ros::Time(0));
+    }
+    catch (const tf2::TransformException& e)
+    {
+      ROS_ERROR_STREAM("Dropping pose target in frame '" << frame << "': " << e.what());
+      return;
+    }
+
+    const geometry_msgs::Vector3& t = transform.transform.translation;
+    const geometry_msgs::Quaternion& q = transform.transform.rotation;
+    const Eigen::Quaterniond rotation(q.w, q.x, q.y, q.z);
+    target.position = rotation * target.position + Eigen::Vector3d(t.x, t.y, t.z);
+    target.orientation = rotation * target.orientation;
+  }
+
+  target_buffer_.writeFromNonRT(target);
+}
+}  // namespace cartesian_ros_control
+
+PLUGINLIB_EXPORT_CLASS(cartesian_ros_control::PoseStreamingController, controller_interface::ControllerBase)
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <pose_streaming_controller/pose_trajectory_generator.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+double clamp(double value, double limit)
+{
+  return (limit > 0.0) ? std::max(-limit, std::min(value, limit)) : value;
+}
+
+/**
+ * @brief The largest speed from which we can stop within \a distance
+ *
+ * The stop starts at zero acceleration and ramps it with \a max_jerk up to
+ * \a max_acc and back. Limits of zero are unlimited.
+ */
+double stoppingSpeed(double distance, double max_acc, double max_jerk, double period)
+{
+  double speed;
+  if (max_jerk > 0.0 && max_acc > 0.0)
+  {
+    // Without reaching max_acc, the stop takes 2 * sqrt(speed / max_jerk) at half the speed on average.
+    if (distance <= max_acc * max_acc * max_acc / (max_jerk * max_jerk))
+    {
+      speed = std::cbrt(distance * distance * max_jerk);
+    }
+    else
+    {
+      const double ramp = max_acc / (2.0 * max_jerk);
+      speed = max_acc * (std::sqrt(ramp * ramp + 2.0 * distance / max_acc) - ramp);
+    }
+  }
+  else if (max_jerk > 0.0)
+  {
+    speed = std::cbrt(distance * distance * max_jerk);
+  }
+  else if (max_acc > 0.0)
+  {
+    speed = std::sqrt(2.0 * max_acc * distance);
+  }
+  else
+  {
+    speed = distance / period;
+  }
+  return std::min(speed, distance / period);
+}
+}  // namespace
+
+void PoseTrajectoryGenerator::reset(const Eigen::Vector3d& position, const Eigen::Quaterniond& orientation)
+{
+  position_ = position;
+  orientation_ = orientation.normalized();
+  twist_.setZero();
+  accel_.setZero();
+}
+
+void PoseTrajectoryGenerator::update(const Eigen::Vector3d& target_position,
+                                     const Eigen::Quaterniond& target_orientation, double period)
+{
+  if (period <= 0.0)
+  {
+    return;
+  }
+
+  Vector6d error;
+  error.head<3>() = target_position - position_;
+  const Eigen::AngleAxisd rotation(target_orientation.normalized() * orientation_.inverse());
+  error.tail<3>() = rotation.angle() * rotation.axis();
+
+  for (int i = 0; i < 6; ++i)
+  {
+    const double max_vel = limits_.velocity[i];
+    const double max_acc = limits_.acceleration[i];
+    const double max_jerk = limits_.jerk[i];
+
+    // Where we'd come to rest relative to now if we ramped the acceleration to zero right away
+    double remaining = error[i];
+    if (max_jerk > 0.0)
+    {
+      const double ramp = std::abs(accel_[i]) / max_jerk;
+      remaining -= twist_[i] * ramp + accel_[i] * ramp * ramp / 3.0;
+    }
+    const double goal =
+        clamp(std::copysign(stoppingSpeed(std::abs(remaining), max_acc, max_jerk, period), remaining), max_vel);
+    const double speed_error = goal - twist_[i];
+
+    if (max_jerk > 0.0)
+    {
+      // Same acceleration ramp as in TwistLimiter. The goal is within the
+      // velocity limit, so the ramp never runs into it.
+      const double step = max_jerk * period;
+      accel_[i] += clamp(clamp(brakingAccel(speed_error, step, period), max_acc) - accel_[i], step);
+    }
+    else
+    {
+      accel_[i] = clamp(speed_error / period, max_acc);
+    }
+
+    const double vel = twist_[i] + accel_[i] * period;
+    const double limited = clamp(vel, max_vel);
+    if (limited != vel)
+    {
+      // Only what the velocity limit lets through
+      accel_[i] = (limited - twist_[i]) / period;
+    }
+    twist_[i] = limited;
+  }
+
+  position_ += twist_.head<3>() * period;
+  const double angle = twist_.tail<3>().norm() * period;
+  if (angle > 0.0)
+  {
+    orientation_ = Eigen::AngleAxisd(angle, twist_.tail<3>().normalized()) * orientation_;
+    orientation_.normalize();
+  }
+}
+
+}  // namespace cartesian_ros_control
@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <pose_streaming_controller/pose_trajectory_generator.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+const double period = 0.002;
+
+TwistLimits testLimits()
+{
+  TwistLimits limits;
+  limits.velocity.setConstant(0.5);
+  limits.acceleration.setConstant(2.0);
+  limits.jerk.setConstant(10.0);
+  return limits;
+}
+
+/**
+ * @brief Checks the generator's limits in every cycle
+ *
+ * Acceleration and jerk come from finite differences of the commanded twist,
+ * so that they cover everything that reaches the robot.
+ */
+class LimitChecker
+{
+public:
+  LimitChecker(const TwistLimits& limits, double period) : limits_(limits), period_(period)
+  {
+  }
+
+  void check(const PoseTrajectoryGenerator& generator)
+  {
+    const Vector6d& twist = generator.getTwist();
+    const Vector6d accel = (twist - last_twist_) / period_;
+    for (int i = 0; i < 6; ++i)
+    {
+      ASSERT_LE(std::abs(twist[i]), limits_.velocity[i] + 1e-9) << "axis " << i;
+      ASSERT_LE(std::abs(accel[i]), limits_.acceleration[i] * (1 + 1e-6)) << "axis " << i;
+      ASSERT_LE(std::abs(accel[i] - last_accel_[i]) / period_, limits_.jerk[i] * (1 + 1e-6)) << "axis " << i;
+    }
+    last_twist_ = twist;
+    last_accel_ = accel;
+  }
+
+private:
+  TwistLimits limits_;
+  double period_;
+  Vector6d last_twist_ = { Vector6d::Zero() };
+  Vector6d last_accel_ = { Vector6d::Zero() };
+};
+}  // namespace
+
+TEST(PoseTrajectoryGeneratorTest, TestUnlimitedFollowsTarget)
+{
+  PoseTrajectoryGenerator generator;
+  generator.reset(Eigen::Vector3d::Zero(), Eigen::Quaterniond::Identity());
+
+  const Eigen::Vector3d position(0.1, -0.2, 0.3);
+  const Eigen::Quaterniond orientation(Eigen::AngleAxisd(0.5, Eigen::Vector3d::UnitY()));
+  generator.update(position, orientation, period);
+
+  EXPECT_TRUE(generator.getPosition().isApprox(position));
+  EXPECT_NEAR(0.0, generator.getOrientation().angularDistance(orientation), 1e-9);
+}
+
+TEST(PoseTrajectoryGeneratorTest, TestHoldPoseAfterReset)
+{
+  PoseTrajectoryGenerator generator;
+  generator.setLimits(testLimits());
+  const Eigen::Vector3d position(0.4, 0.0, 0.6);
+  const Eigen::Quaterniond orientation(0.0, 1.0, 0.0, 0.0);
+  generator.reset(position, orientation);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    generator.update(position, orientation, period);
+  }
+  EXPECT_TRUE(generator.getPosition().isApprox(position));
+  EXPECT_NEAR(0.0, generator.getOrientation().angularDistance(orientation), 1e-12);
+  EXPECT_TRUE(generator.getTwist().isZero());
+}
+
+TEST(PoseTrajectoryGeneratorTest, TestStepStaysWithinLimits)
+{
+  const TwistLimits limits = testLimits();
+  PoseTrajectoryGenerator generator;
+  generator.setLimits(limits);
+  generator.reset(Eigen::Vector3d::Zero(), Eigen::Quaterniond::Identity());
+
+  const Eigen::Vector3d position(0.2, -0.05, 0.0);
+  const Eigen::Quaterniond orientation(Eigen::AngleAxisd(1.0, Eigen::Vector3d::UnitZ()));
+  LimitChecker checker(limits, period);
+  double overshoot = 0.0;
+  for (int i = 0; i < 2000; ++i)
+  {
+    generator.update(position, orientation, period);
+    checker.check(generator);
+    overshoot = std::max(overshoot, generator.getPosition().x() - position.x());
+  }
+
+  EXPECT_LT(overshoot, 1e-4);
+  EXPECT_TRUE(generator.getPosition().isApprox(position, 1e-6));
+  EXPECT_NEAR(0.0, generator.getOrientation().angularDistance(orientation), 1e-6);
+  EXPECT_NEAR(0.0, generator.getTwist().norm(), 1e-6);
+}
+
+TEST(PoseTrajectoryGeneratorTest, TestLowRateTargetsBecomeSmooth)
+{
+  const TwistLimits limits = testLimits();
+  PoseTrajectoryGenerator generator;
+  generator.setLimits(limits);
+  generator.reset(Eigen::Vector3d::Zero(), Eigen::Quaterniond::Identity());
+
+  // A sine wave sampled at 30 Hz, i.e. a staircase for the 500 Hz control loop
+  LimitChecker checker(limits, period);
+  Eigen::Vector3d position = Eigen::Vector3d::Zero();
+  double error = 0.0;
+  for (int i = 0; i < 2500; ++i)
+  {
+    const double time = i * period;
+    position.x() = 0.1 * std::sin(std::floor(time * 30.0) / 30.0);
+    generator.update(position, Eigen::Quaterniond::Identity(), period);
+    checker.check(generator);
+    if (time > 1.0)
+    {
+      error = std::max(error, std::abs(generator.getPosition().x() - 0.1 * std::sin(time)));
+    }
+  }
+  EXPECT_LT(error, 0.03);
+}
+
+TEST(PoseTrajectoryGeneratorTest, TestRandomTargetsStayWithinLimits)
+{
+  TwistLimits limits;
+  limits.velocity.setConstant(0.5);
+  limits.acceleration.setConstant(1.0);
+  limits.jerk.setConstant(5.0);
+
+  // Far apart targets at 30 Hz keep the generator at its velocity limit
+  for (const double cycle : { 0.001, 0.004 })
+  {
+    PoseTrajectoryGenerator generator;
+    generator.setLimits(limits);
+    generator.reset(Eigen::Vector3d::Zero(), Eigen::Quaterniond::Identity());
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+    LimitChecker checker(limits, cycle);
+    Eigen::Vector3d position = Eigen::Vector3d::Zero();
+    Eigen::Quaterniond orientation = Eigen::Quaterniond::Identity();
+    const int cycles = static_cast<int>(20.0 / cycle);
+    const int per_target = static_cast<int>(1.0 / (30.0 * cycle));
+    for (int i = 0; i < cycles; ++i)
+    {
+      if (i % per_target == 0)
+      {
+        position = Eigen::Vector3d(coordinate(rng), coordinate(rng), coordinate(rng));
+        orientation = Eigen::AngleAxisd(coordinate(rng), Eigen::Vector3d::UnitZ());
+      }
+      generator.update(position, orientation, cycle);
+      ASSERT_NO_FATAL_FAILURE(checker.check(generator)) << "cycle " << i << " at " << cycle << " s";
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
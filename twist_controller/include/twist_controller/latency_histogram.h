@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief A fixed-bucket histogram of durations in nanoseconds
+ *
+ * One real-time thread records values, while any other thread may read
+ * them. Recording is wait-free and never allocates: Every counter is an
+ * atomic that only its single writer modifies, so readers see each counter
+ * consistently, although not necessarily all counters from the same cycle.
+ *
+ * Values beyond the last bucket are counted in an extra overflow bucket.
+ */
+class LatencyHistogram
+{
+public:
+  LatencyHistogram() = default;
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  /**
+   * @brief Allocate \a buckets buckets of \a bucket_width nanoseconds each
+   *
+   * Not real-time safe. Call this only while nobody records.
+   */
+  void reset(size_t buckets, uint64_t bucket_width)
+  {
+    size_ = buckets + 1;
+    bucket_width_ = (bucket_width > 0) ? bucket_width : 1;
+    buckets_.reset(new std::atomic<uint64_t>[size_]);
+    clear();
+  }
+
+  /**
+   * @brief Forget all recorded values. Writer side only.
+   */
+  void clear()
+  {
+    for (size_t i = 0; i < size_; ++i)
+    {
+      buckets_[i].store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Record \a value nanoseconds. Writer side only.
+   */
+  void record(uint64_t value)
+  {
+    if (!buckets_)
+    {
+      return;
+    }
+    const size_t bucket = std::min<uint64_t>(value / bucket_width_, size_ - 1);
+    increment(buckets_[bucket], 1);
+    increment(sum_, value);
+    if (value < min_.load(std::memory_order_relaxed))
+    {
+      min_.store(value, std::memory_order_relaxed);
+    }
+    if (value > max_.load(std::memory_order_relaxed))
+    {
+      max_.store(value, std::memory_order_relaxed);
+    }
+    // Readers that see the new count also see the value in its bucket
+    count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Append count, min, max, sum and all bucket counts to \a out
+   *
+   * The last bucket counts overflows. Min is zero if nothing was recorded.
+   */
+  void read(std::vector<uint64_t>& out) const
+  {
+    const uint64_t count = count_.load(std::memory_order_acquire);
+    out.push_back(count);
+    out.push_back(count > 0 ? min_.load(std::memory_order_relaxed) : 0);
+    out.push_back(max_.load(std::memory_order_relaxed));
+    out.push_back(sum_.load(std::memory_order_relaxed));
+    for (size_t i = 0; i < size_; ++i)
+    {
+      out.push_back(buckets_[i].load(std::memory_order_relaxed));
+    }
+  }
+
+  uint64_t count() const
+  {
+    return count_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Number of buckets including the overflow bucket
+   */
+  size_t size() const
+  {
+    return size_;
+  }
+
+  uint64_t getBucketWidth() const
+  {
+    return bucket_width_;
+  }
+
+private:
+  static void increment(std::atomic<uint64_t>& counter, uint64_t value)
+  {
+    // Single writer: No read-modify-write instruction needed
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+  }
+
+  std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+  size_t size_ = { 0 };
+  uint64_t bucket_width_ = { 1 };
+  std::atomic<uint64_t> count_ = { 0 };
+  std::atomic<uint64_t> sum_ = { 0 };
+  std::atomic<uint64_t> min_ = { std::numeric_limits<uint64_t>::max() };
+  std::atomic<uint64_t> max_ = { 0 };
+};
+
+}  // namespace cartesian_ros_control
@@ -39,11 +39,28 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
 #include <controller_interface/controller.h>
 #include <geometry_msgs/TwistStamped.h>
 #include <realtime_tools/realtime_buffer.h>
+#include <realtime_tools/realtime_publisher.h>
+#include <std_msgs/Empty.h>
+#include <std_msgs/Float64MultiArray.h>
+#include <std_msgs/UInt64.h>
+#include <std_msgs/UInt64MultiArray.h>
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
 
+#include <cartesian_flight_recorder/flight_recorder.h>
 #include <cartesian_interface/cartesian_command_interface.h>
+#include <cartesian_interface/shared_memory_slot.h>
+#include <cartesian_interface/spsc_queue.h>
+#include <twist_controller/latency_histogram.h>
+#include <twist_controller/twist_limiter.h>
 
 namespace cartesian_ros_control
 {
@@ -55,10 +72,102 @@ namespace cartesian_ros_control
  * twist message as reference for robot control.
  * The according hardware_interface::RobotHW can send these commands
  * directly to the robot driver in its write() function.
+ *
+ * Commands pass through a TwistLimiter with the per-axis limits from the
+ * \a max_velocity, \a max_acceleration and \a max_jerk parameters before
+ * they reach the handle. If no new command arrives within
+ * \a command_timeout seconds, the controller ramps down to zero twist
+ * within these limits.
+ *
+ * Besides plain twists on \a command, which are expressed in the handle's
+ * reference frame, the controller accepts TwistStamped messages on
+ * \a command_stamped. Their header's frame_id can be the reference frame,
+ * the controlled frame (\a frame_id) for jogging in tool coordinates, or
+ * any other frame that is fixed with respect to the reference frame. Tool
+ * frame commands are rotated with the handle's current orientation in
+ * update(), so that they never lag behind the robot's motion.
+ *
+ * Commands are scaled per axis with the \a gain parameter, either a single
+ * value or six values for linear x, y, z and angular x, y, z. The axes are
+ * those of the frame the command is given in. The gains can be retuned at
+ * runtime by publishing one or six values to \a gain.
+ *
+ * For latency budgets, update() records three histograms: the age of each
+ * new command when it is first used, the execution time of update() itself
+ * and the jitter between the measured and the given cycle period. They are
+ * published on \a statistics with \a statistics/publish_rate (zero
+ * disables them). Each row holds count, min, max and sum in nanoseconds,
+ * followed by \a statistics/buckets buckets of
+ * \a statistics/bucket_width nanoseconds and an overflow bucket.
+ *
+ * By default, only the latest command counts. With a positive
+ * \a queue_size, commands are queued in a wait-free ring instead and
+ * update() consumes all of them that are due, in order, and averages
+ * their twists. This preserves input streams that are faster than the
+ * control loop. Stamps in the future are clamped to the time of receipt.
+ * Commands that don't fit into the queue are dropped and their total is
+ * published on \a dropped_commands with \a statistics/publish_rate, or
+ * once per second if that is zero.
+ *
+ * For low latency inputs, both subscriptions disable Nagle's algorithm.
+ * Publishers in the same process, e.g. teleop nodelets that publish
+ * shared pointers, reach the callbacks without serialization. Code that
+ * runs in the controller manager's process can skip ROS altogether and
+ * call setCommand() directly on the controller, e.g. obtained through
+ * controller_manager::ControllerManager::getControllerByName().
+ *
+ * Producers in other processes on the same machine, e.g. haptic devices
+ * at 1 kHz, can bypass ROS through shared memory. With the
+ * \a shared_memory parameter set to a name such as "/twist_command", the
+ * controller creates a SharedMemorySlot of SharedTwistCommand under that
+ * name in init(), and update() picks up new samples without system calls.
+ * Their stamps feed the command age statistics and the timeout, where
+ * stamps ahead of the controller's time count as current. Topics remain
+ * active, and whichever source delivered the latest new command is used.
+ *
+ * For incident analysis, update() can record the handle's state, the
+ * command it acted on and the twist it sent in each cycle with a
+ * FlightRecorder. It is enabled by setting \a flight_recorder/path to a
+ * file name. \a flight_recorder/mode is either "continuous" or
+ * "triggered", and \a flight_recorder/records,
+ * \a flight_recorder/post_trigger_records and
+ * \a flight_recorder/flush_period map onto FlightRecorderSettings. The
+ * recorder is triggered by a message on \a flight_recorder/trigger and,
+ * unless \a flight_recorder/trigger_on_timeout is false, when a command
+ * source times out.
  */
 class TwistController : public controller_interface::Controller<TwistCommandInterface>
 {
 public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /**
+   * @brief A target twist and when it was sent
+   *
+   * The twist is expressed in the frame it was given in. \a rotation maps
+   * that frame onto the handle's reference frame, unless \a in_tool_frame
+   * is set, in which case the handle's current orientation is used.
+   */
+  struct TwistCommand
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    Vector6d twist = { Vector6d::Zero() };
+    Eigen::Matrix3d rotation = { Eigen::Matrix3d::Identity() };
+    ros::Time stamp;
+    ros::Time received;
+    uint64_t sequence = { 0 };
+    bool in_tool_frame = { false };
+  };
+
+  /**
+   * @brief Per-axis scaling of incoming commands
+   */
+  struct TwistGain
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    Vector6d values = { Vector6d::Constant(0.1) };
+  };
+
   TwistController() = default;
   virtual ~TwistController() = default;
 
@@ -66,18 +175,117 @@ public:
 
   virtual void starting(const ros::Time& time) override;
 
-  virtual void update(const ros::Time& /*time*/, const ros::Duration& /*period*/) override
-  {
-    handle_.setTwist(*command_buffer_.readFromRT());
-  }
+  virtual void update(const ros::Time& time, const ros::Duration& period) override;
+
+  /**
+   * @brief Pass a command to update() without a ROS hop
+   *
+   * Thread-safe for any number of non-real-time callers, and equivalent to
+   * receiving the command on a topic. A zero \a received time is set to
+   * now, a zero or future \a stamp to \a received. The sequence is
+   * assigned here.
+   */
+  void setCommand(const TwistCommand& command);
+
+  /**
+   * @brief Pass a twist in the handle's reference frame to update() without a ROS hop
+   *
+   * @param twist Linear x, y, z followed by angular x, y, z
+   */
+  void setCommand(const Vector6d& twist);
+
+  /**
+   * @brief Replace the limits from the \a max_velocity, \a max_acceleration and \a max_jerk parameters
+   *
+   * Together with setCommandTimeout() and \a gain_buffer_, this configures
+   * the controller without a ROS node, e.g. for offline replay. Not
+   * thread-safe with update().
+   */
+  void setLimits(const TwistLimits& limits);
+
+  /**
+   * @brief Replace the \a command_timeout parameter. Zero disables the timeout.
+   */
+  void setCommandTimeout(const ros::Duration& timeout);
+
+  /**
+   * @brief Replace the \a queue_size parameter. Zero disables the queued mode.
+   *
+   * Drops all queued commands. Not thread-safe with update() or setCommand().
+   */
+  void setQueueSize(size_t queue_size);
+
+  /**
+   * @brief Create the shared memory slot from the \a shared_memory parameter
+   *
+   * @return False with a human readable \a error if the slot can't be created
+   */
+  bool openSharedMemory(const std::string& name, std::string& error);
+
+  /**
+   * @brief Record every cycle as configured by the \a flight_recorder parameters
+   *
+   * Not thread-safe with update().
+   *
+   * @return False with a human readable \a error if the file can't be created
+   */
+  bool openFlightRecorder(const FlightRecorderSettings& settings, std::string& error);
 
   TwistCommandHandle handle_;
-  realtime_tools::RealtimeBuffer<geometry_msgs::Twist> command_buffer_;
+  realtime_tools::RealtimeBuffer<TwistCommand> command_buffer_;
+  realtime_tools::RealtimeBuffer<TwistGain> gain_buffer_;
+
+protected:
+  void writeCommand(const TwistCommand& command);
+  void twistCallback(const geometry_msgs::TwistConstPtr& msg);
+  void twistStampedCallback(const geometry_msgs::TwistStampedConstPtr& msg);
 
 private:
+  TwistLimiter limiter_;
+  ros::Duration command_timeout_;  ///< Zero disables the timeout
+  geometry_msgs::Twist twist_;
+
   ros::Subscriber twist_sub_;
-  void twistCallback(const geometry_msgs::TwistConstPtr& msg);
-  double gain_ = { 0.1 };
+  ros::Subscriber twist_stamped_sub_;
+  ros::Subscriber gain_sub_;
+  std::unique_ptr<tf2_ros::Buffer> tf_buffer_;
+  std::unique_ptr<tf2_ros::TransformListener> tf_listener_;
+  void gainCallback(const std_msgs::Float64MultiArrayConstPtr& msg);
+  std::atomic<uint64_t> command_sequence_ = { 0 };
+
+  // Queued mode
+  bool consumeQueue(const ros::Time& time);  ///< Averages into rt_command_. True if anything was due.
+  bool queued_ = { false };
+  std::mutex queue_mutex_;  ///< Serializes the producers. Never taken in update().
+  SpscQueue<TwistCommand, Eigen::aligned_allocator<TwistCommand>> command_queue_;
+  std::atomic<uint64_t> dropped_commands_ = { 0 };
+  TwistCommand rt_command_;
+
+  // Shared memory ingress
+  bool readSharedMemory(const ros::Time& time);
+  SharedMemorySlot<SharedTwistCommand> shared_memory_;
+  TwistCommand rt_shared_command_;
+  bool rt_shared_newer_ = { false };  ///< The latest new command came from shared memory
+
+  // Flight recorder
+  void flightRecorderTriggerCallback(const std_msgs::EmptyConstPtr& msg);
+  FlightRecorder flight_recorder_;
+  ros::Subscriber flight_recorder_trigger_sub_;
+  bool trigger_on_timeout_ = { true };
+  bool rt_timed_out_ = { false };
+
+  // Statistics, recorded in update() and published from a timer
+  void publishStatistics(const ros::TimerEvent& event);
+  void publishDropped(const ros::TimerEvent& event);
+  LatencyHistogram command_age_;
+  LatencyHistogram update_duration_;
+  LatencyHistogram period_jitter_;
+  uint64_t rt_last_sequence_ = { 0 };
+  std::chrono::steady_clock::time_point rt_last_update_;
+  ros::Timer statistics_timer_;
+  std::unique_ptr<realtime_tools::RealtimePublisher<std_msgs::UInt64MultiArray>> statistics_publisher_;
+  ros::Timer dropped_timer_;
+  std::unique_ptr<realtime_tools::RealtimePublisher<std_msgs::UInt64>> dropped_publisher_;
 };
 
 }  // namespace cartesian_ros_control
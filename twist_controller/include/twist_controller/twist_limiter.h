@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+
+#include <cartesian_interface/twist_limits.h>
+
+namespace cartesian_ros_control
+{
+
+/**
+ * @brief Shapes a stream of target twists into a jerk-limited command
+ *
+ * Each call to update() moves the command one step towards the target.
+ * Acceleration is ramped with bounded jerk and already starts ramping down
+ * before the target is reached, so that steps in the target, e.g. from
+ * noisy inputs or a sudden stop, never reach the robot as steps.
+ *
+ * update() neither allocates nor blocks and is safe to call in real-time.
+ */
+class TwistLimiter
+{
+public:
+  TwistLimiter() = default;
+
+  void setLimits(const TwistLimits& limits)
+  {
+    limits_ = limits;
+  }
+
+  const TwistLimits& getLimits() const
+  {
+    return limits_;
+  }
+
+  /**
+   * @brief Restart from \a twist with zero acceleration
+   */
+  void reset(const Vector6d& twist = Vector6d::Zero());
+
+  /**
+   * @brief Advance the command by \a period seconds towards \a target
+   *
+   * @return The limited twist command
+   */
+  const Vector6d& update(const Vector6d& target, double period);
+
+  const Vector6d& getTwist() const
+  {
+    return twist_;
+  }
+
+  const Vector6d& getAccel() const
+  {
+    return accel_;
+  }
+
+private:
+  TwistLimits limits_;
+  Vector6d twist_ = { Vector6d::Zero() };
+  Vector6d accel_ = { Vector6d::Zero() };
+};
+
+}  // namespace cartesian_ros_control
@@ -40,8 +40,31 @@
 #include <twist_controller/twist_controller.h>
 #include <pluginlib/class_list_macros.hpp>
 
+#include <cstdlib>
+
 namespace cartesian_ros_control
 {
+namespace
+{
+/**
+ * @brief Expand one gain for all axes or take six individual ones
+ */
+bool toGain(const std::vector<double>& values, Vector6d& gain)
+{
+  if (values.size() == 1)
+  {
+    gain.setConstant(values[0]);
+    return true;
+  }
+  if (values.size() == 6)
+  {
+    gain = Eigen::Map<const Vector6d>(values.data());
+    return true;
+  }
+  return false;
+}
+}  // namespace
+
 bool TwistController::init(TwistCommandInterface* hw, ros::NodeHandle& n)
 {
   std::string frame_id;
@@ -52,7 +75,12 @@ bool TwistController::init(TwistCommandInterface* hw, ros::NodeHandle& n)
   }
 
   handle_ = hw->getHandle(frame_id);
-  twist_sub_ = n.subscribe<geometry_msgs::Twist>("command", 1, &TwistController::twistCallback, this);
+  tf_buffer_.reset(new tf2_ros::Buffer());
+  tf_listener_.reset(new tf2_ros::TransformListener(*tf_buffer_));
+  twist_sub_ = n.subscribe<geometry_msgs::Twist>("command", 1, &TwistController::twistCallback, this,
+                                                 ros::TransportHints().tcpNoDelay());
+  twist_stamped_sub_ = n.subscribe<geometry_msgs::TwistStamped>(
+      "command_stamped", 1, &TwistController::twistStampedCallback, this, ros::TransportHints().tcpNoDelay());
 
   std::vector<std::string> joint_names;
   if (!n.getParam("joints", joint_names))
@@ -66,31 +94,447 @@ bool TwistController::init(TwistCommandInterface* hw, ros::NodeHandle& n)
     hw->claim(name);
   }
 
+  TwistLimits limits;
+  if (!readTwistLimits(n, limits))
+  {
+    return false;
+  }
+  limiter_.setLimits(limits);
+
+  double command_timeout = n.param("command_timeout", 0.5);
+  if (command_timeout < 0.0)
+  {
+    ROS_ERROR_STREAM("Parameter " << n.resolveName("command_timeout") << " must not be negative.");
+    return false;
+  }
+  command_timeout_ = ros::Duration(command_timeout);
+
+  TwistGain gain;
+  std::vector<double> gain_values;
+  double scalar_gain = 0.0;
+  if (n.getParam("gain", scalar_gain))
+  {
+    gain.values.setConstant(scalar_gain);
+  }
+  else if (n.getParam("gain", gain_values) && !toGain(gain_values, gain.values))
+  {
+    ROS_ERROR_STREAM("Parameter " << n.resolveName("gain") << " needs 1 or 6 values.");
+    return false;
+  }
+  gain_buffer_.initRT(gain);
+  gain_sub_ = n.subscribe<std_msgs::Float64MultiArray>("gain", 1, &TwistController::gainCallback, this);
+
+  std::string shared_memory;
+  if (n.getParam("shared_memory", shared_memory) && !shared_memory.empty())
+  {
+    std::string error;
+    if (!openSharedMemory(shared_memory, error))
+    {
+      ROS_ERROR_STREAM(error);
+      return false;
+    }
+  }
+
+  std::string recorder_path;
+  if (n.getParam("flight_recorder/path", recorder_path) && !recorder_path.empty())
+  {
+    FlightRecorderSettings settings;
+    settings.path = recorder_path;
+    const std::string mode = n.param<std::string>("flight_recorder/mode", "continuous");
+    if (mode == "triggered")
+    {
+      settings.mode = FlightRecorderSettings::TRIGGERED;
+    }
+    else if (mode != "continuous")
+    {
+      ROS_ERROR_STREAM("Parameter " << n.resolveName("flight_recorder/mode")
+                                    << " must be either 'continuous' or 'triggered'.");
+      return false;
+    }
+    const int records = n.param("flight_recorder/records", static_cast<int>(settings.records));
+    const int post_trigger_records =
+        n.param("flight_recorder/post_trigger_records", static_cast<int>(settings.post_trigger_records));
+    if (records < 1 || post_trigger_records < 0)
+    {
+      ROS_ERROR_STREAM("Parameter " << n.resolveName("flight_recorder/records") << " must be positive and "
+                                    << n.resolveName("flight_recorder/post_trigger_records")
+                                    << " must not be negative.");
+      return false;
+    }
+    settings.records = records;
+    settings.post_trigger_records = post_trigger_records;
+    settings.flush_period = n.param("flight_recorder/flush_period", settings.flush_period);
+    trigger_on_timeout_ = n.param("flight_recorder/trigger_on_timeout", true);
+
+    std::string error;
+    if (!openFlightRecorder(settings, error))
+    {
+      ROS_ERROR_STREAM(error);
+      return false;
+    }
+    flight_recorder_trigger_sub_ = n.subscribe<std_msgs::Empty>(
+        "flight_recorder/trigger", 1, &TwistController::flightRecorderTriggerCallback, this);
+  }
+
+  int queue_size = n.param("queue_size", 0);
+  setQueueSize(queue_size > 0 ? queue_size : 0);
+
+  double statistics_rate = n.param("statistics/publish_rate", 1.0);
+  if (statistics_rate > 0.0)
+  {
+    int buckets = n.param("statistics/buckets", 40);
+    int bucket_width = n.param("statistics/bucket_width", 50000);
+    if (buckets < 1 || bucket_width < 1)
+    {
+      ROS_ERROR_STREAM("Parameters " << n.resolveName("statistics/buckets") << " and "
+                                     << n.resolveName("statistics/bucket_width") << " must be positive.");
+      return false;
+    }
+    command_age_.reset(buckets, bucket_width);
+    update_duration_.reset(buckets, bucket_width);
+    period_jitter_.reset(buckets, bucket_width);
+
+    statistics_publisher_.reset(
+        new realtime_tools::RealtimePublisher<std_msgs::UInt64MultiArray>(n, "statistics", 1));
+    statistics_timer_ =
+        n.createTimer(ros::Duration(1.0 / statistics_rate), &TwistController::publishStatistics, this);
+  }
+
+  if (queued_)
+  {
+    // Dropped commands are reported even without statistics
+    dropped_publisher_.reset(new realtime_tools::RealtimePublisher<std_msgs::UInt64>(n, "dropped_commands", 1));
+    const double dropped_rate = statistics_rate > 0.0 ? statistics_rate : 1.0;
+    dropped_timer_ = n.createTimer(ros::Duration(1.0 / dropped_rate), &TwistController::publishDropped, this);
+  }
+
   return true;
 }
 
 void TwistController::starting(const ros::Time& time)
 {
-  geometry_msgs::Twist twist;
-  twist.linear.x = 0;
-  twist.linear.y = 0;
-  twist.linear.z = 0;
-  twist.angular.x = 0;
-  twist.angular.y = 0;
-  twist.angular.z = 0;
-  command_buffer_.writeFromNonRT(twist);
+  TwistCommand command;
+  command.stamp = time;
+  command_buffer_.initRT(command);
+  rt_command_ = command;
+  limiter_.reset();
+
+  // Forget what was queued while we were stopped
+  while (command_queue_.pop())
+  {
+  }
+  if (shared_memory_.isOpen())
+  {
+    SharedTwistCommand stale;
+    shared_memory_.read(stale);
+  }
+  rt_shared_newer_ = false;
+  rt_timed_out_ = false;
+
+  command_age_.clear();
+  update_duration_.clear();
+  period_jitter_.clear();
+  rt_last_sequence_ = 0;
+  rt_last_update_ = std::chrono::steady_clock::time_point();
+}
+
+void TwistController::update(const ros::Time& time, const ros::Duration& period)
+{
+  using std::chrono::nanoseconds;
+  using std::chrono::steady_clock;
+
+  const steady_clock::time_point update_start = steady_clock::now();
+  if (rt_last_update_.time_since_epoch().count() != 0)
+  {
+    const int64_t measured = std::chrono::duration_cast<nanoseconds>(update_start - rt_last_update_).count();
+    period_jitter_.record(std::abs(measured - static_cast<int64_t>(period.toNSec())));
+  }
+  rt_last_update_ = update_start;
+
+  const TwistCommand* latest;
+  if (queued_)
+  {
+    // Ages are recorded per queued command
+    if (consumeQueue(time))
+    {
+      rt_shared_newer_ = false;
+    }
+    latest = &rt_command_;
+  }
+  else
+  {
+    latest = command_buffer_.readFromRT();
+    if (latest->sequence != rt_last_sequence_)
+    {
+      rt_last_sequence_ = latest->sequence;
+      const int64_t age = (time - latest->received).toNSec();
+      command_age_.record(age > 0 ? age : 0);
+      rt_shared_newer_ = false;
+    }
+  }
+  if (shared_memory_.isOpen() && readSharedMemory(time))
+  {
+    rt_shared_newer_ = true;
+  }
+  const TwistCommand& command = rt_shared_newer_ ? rt_shared_command_ : *latest;
+
+  // Deadman: Stop if the command source went silent
+  const bool timed_out = !command_timeout_.isZero() && time - command.stamp > command_timeout_;
+  if (timed_out)
+  {
+    // Only sources that actually sent something can go silent
+    if (!rt_timed_out_ && trigger_on_timeout_ && (rt_shared_newer_ || command.sequence != 0))
+    {
+      flight_recorder_.trigger();
+    }
+    limiter_.update(Vector6d::Zero(), period.toSec());
+  }
+  else
+  {
+    // Scale in the command's own frame. All six axes in one packed multiply.
+    const Vector6d scaled = command.twist.cwiseProduct(gain_buffer_.readFromRT()->values);
+
+    // The command is the controlled frame's own twist, so re-expressing it
+    // in the reference frame only takes the orientation.
+    const Eigen::Matrix3d rotation =
+        command.in_tool_frame ? handle_.getOrientationMap().toRotationMatrix() : command.rotation;
+    Vector6d target;
+    target.head<3>().noalias() = rotation * scaled.head<3>();
+    target.tail<3>().noalias() = rotation * scaled.tail<3>();
+    limiter_.update(target, period.toSec());
+  }
+
+  const Vector6d& twist = limiter_.getTwist();
+  twist_.linear.x = twist[0];
+  twist_.linear.y = twist[1];
+  twist_.linear.z = twist[2];
+  twist_.angular.x = twist[3];
+  twist_.angular.y = twist[4];
+  twist_.angular.z = twist[5];
+  handle_.setTwist(twist_);
+  rt_timed_out_ = timed_out;
+  if (flight_recorder_.isOpen())
+  {
+    const Eigen::Quaterniond rotation(command.rotation);
+    const FlightRecordInput input = { command.twist.data(), rotation.coeffs().data(),
+                                      static_cast<int64_t>(command.stamp.toNSec()), command.in_tool_frame };
+    flight_recorder_.record(time, handle_, &input);
+  }
+
+  update_duration_.record(std::chrono::duration_cast<nanoseconds>(steady_clock::now() - update_start).count());
+}
+
+bool TwistController::consumeQueue(const ros::Time& time)
+{
+  // Average all commands that are due in this cycle. A change of frames
+  // restarts the average, so that we only add up compatible twists.
+  size_t count = 0;
+  const TwistCommand* next;
+  while ((next = command_queue_.front()) && !(next->stamp > time))
+  {
+    const int64_t age = (time - next->received).toNSec();
+    command_age_.record(age > 0 ? age : 0);
+
+    if (count > 0 && next->in_tool_frame == rt_command_.in_tool_frame && next->rotation == rt_command_.rotation)
+    {
+      rt_command_.twist += next->twist;
+      rt_command_.stamp = next->stamp;
+      rt_command_.received = next->received;
+      rt_command_.sequence = next->sequence;
+      ++count;
+    }
+    else
+    {
+      rt_command_ = *next;
+      count = 1;
+    }
+    command_queue_.pop();
+  }
+  if (count > 1)
+  {
+    rt_command_.twist /= static_cast<double>(count);
+  }
+  return count > 0;
+}
+
+bool TwistController::readSharedMemory(const ros::Time& time)
+{
+  SharedTwistCommand sample;
+  if (!shared_memory_.read(sample))
+  {
+    return false;
+  }
+
+  rt_shared_command_.twist = Eigen::Map<const Vector6d>(sample.twist);
+  rt_shared_command_.in_tool_frame = sample.frame == SharedTwistCommand::CONTROLLED_FRAME;
+  rt_shared_command_.received = time;
+  if (sample.stamp > 0)
+  {
+    rt_shared_command_.stamp.fromNSec(sample.stamp);
+    const int64_t age = (time - rt_shared_command_.stamp).toNSec();
+    command_age_.record(age > 0 ? age : 0);
+  }
+  if (sample.stamp <= 0 || rt_shared_command_.stamp > time)
+  {
+    // Stamps ahead of us, e.g. wall clock against sim time, would defeat the timeout
+    rt_shared_command_.stamp = time;
+  }
+  return true;
+}
+
+void TwistController::setQueueSize(size_t queue_size)
+{
+  queued_ = queue_size > 0;
+  command_queue_.reset(queue_size);
+}
+
+bool TwistController::openSharedMemory(const std::string& name, std::string& error)
+{
+  return shared_memory_.open(name, true, error);
+}
+
+bool TwistController::openFlightRecorder(const FlightRecorderSettings& settings, std::string& error)
+{
+  return flight_recorder_.open(settings, error);
+}
+
+void TwistController::setLimits(const TwistLimits& limits)
+{
+  limiter_.setLimits(limits);
+}
+
+void TwistController::setCommandTimeout(const ros::Duration& timeout)
+{
+  command_timeout_ = timeout;
+}
+
+void TwistController::writeCommand(const TwistCommand& command)
+{
+  if (!queued_)
+  {
+    command_buffer_.writeFromNonRT(command);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(queue_mutex_);
+  if (!command_queue_.push(command))
+  {
+    ++dropped_commands_;
+  }
+}
+
+void TwistController::setCommand(const TwistCommand& command)
+{
+  TwistCommand stamped = command;
+  if (stamped.received.isZero())
+  {
+    stamped.received = ros::Time::now();
+  }
+  if (stamped.stamp.isZero() || stamped.stamp > stamped.received)
+  {
+    // Future stamps would hold up all queued commands behind them
+    stamped.stamp = stamped.received;
+  }
+  stamped.sequence = ++command_sequence_;
+  writeCommand(stamped);
+}
+
+void TwistController::setCommand(const Vector6d& twist)
+{
+  TwistCommand command;
+  command.twist = twist;
+  setCommand(command);
 }
 
 void TwistController::twistCallback(const geometry_msgs::TwistConstPtr& msg)
 {
-  geometry_msgs::Twist twist;
-  twist.linear.x = gain_ * msg->linear.x;
-  twist.linear.y = gain_ * msg->linear.y;
-  twist.linear.z = gain_ * msg->linear.z;
-  twist.angular.x = gain_ * msg->angular.x;
-  twist.angular.y = gain_ * msg->angular.y;
-  twist.angular.z = gain_ * msg->angular.z;
-  command_buffer_.writeFromNonRT(twist);
+  TwistCommand command;
+  command.twist << msg->linear.x, msg->linear.y, msg->linear.z, msg->angular.x, msg->angular.y, msg->angular.z;
+  setCommand(command);
+}
+
+void TwistController::twistStampedCallback(const geometry_msgs::TwistStampedConstPtr& msg)
+{
+  const geometry_msgs::Twist& twist = msg->twist;
+  TwistCommand command;
+  command.twist << twist.linear.x, twist.linear.y, twist.linear.z, twist.angular.x, twist.angular.y, twist.angular.z;
+  command.received = ros::Time::now();
+  command.stamp = msg->header.stamp;
+
+  const std::string& frame = msg->header.frame_id;
+  if (frame == handle_.getName())
+  {
+    command.in_tool_frame = true;
+  }
+  else if (!frame.empty() && frame != handle_.getReferenceFrame())
+  {
+    // Frames that are fixed with respect to the reference frame need the
+    // same rotation every time, so we resolve it right here.
+    geometry_msgs::TransformStamped transform;
+    try
+    {
+      transform = tf_buffer_->lookupTransform(handle_.getReferenceFrame(), frame, ros::Time(0));
+    }
+    catch (const tf2::TransformException& e)
+    {
+      ROS_ERROR_STREAM("Dropping twist command in frame '" << frame << "': " << e.what());
+      return;
+    }
+
+    const geometry_msgs::Quaternion& q = transform.transform.rotation;
+    command.rotation = Eigen::Quaterniond(q.w, q.x, q.y, q.z).toRotationMatrix();
+  }
+
+  setCommand(command);
+}
+
+void TwistController::gainCallback(const std_msgs::Float64MultiArrayConstPtr& msg)
+{
+  TwistGain gain;
+  if (!toGain(msg->data, gain.values))
+  {
+    ROS_ERROR_STREAM("Ignoring gain update with " << msg->data.size() << " values. Need 1 or 6.");
+    return;
+  }
+  gain_buffer_.writeFromNonRT(gain);
+}
+
+void TwistController::flightRecorderTriggerCallback(const std_msgs::EmptyConstPtr& /*msg*/)
+{
+  flight_recorder_.trigger();
+}
+
+void TwistController::publishStatistics(const ros::TimerEvent& /*event*/)
+{
+  if (!statistics_publisher_->trylock())
+  {
+    return;
+  }
+
+  std_msgs::UInt64MultiArray& msg = statistics_publisher_->msg_;
+  const uint32_t row = 4 + command_age_.size();
+  msg.layout.dim.resize(2);
+  msg.layout.dim[0].label = "command_age,update_duration,period_jitter";
+  msg.layout.dim[0].size = 3;
+  msg.layout.dim[0].stride = 3 * row;
+  msg.layout.dim[1].label = "count,min,max,sum,buckets";
+  msg.layout.dim[1].size = row;
+  msg.layout.dim[1].stride = row;
+
+  msg.data.clear();
+  command_age_.read(msg.data);
+  update_duration_.read(msg.data);
+  period_jitter_.read(msg.data);
+  statistics_publisher_->unlockAndPublish();
+}
+
+void TwistController::publishDropped(const ros::TimerEvent& /*event*/)
+{
+  if (dropped_publisher_->trylock())
+  {
+    dropped_publisher_->msg_.data = dropped_commands_.load();
+    dropped_publisher_->unlockAndPublish();
+  }
 }
 }  // namespace cartesian_ros_control
 
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <twist_controller/twist_limiter.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cartesian_ros_control
+{
+namespace
+{
+double clamp(double value, double limit)
+{
+  return (limit > 0.0) ? std::max(-limit, std::min(value, limit)) : value;
+}
+}  // namespace
+
+void TwistLimiter::reset(const Vector6d& twist)
+{
+  twist_ = twist;
+  accel_.setZero();
+}
+
+const Vector6d& TwistLimiter::update(const Vector6d& target, double period)
+{
+  if (period <= 0.0)
+  {
+    return twist_;
+  }
+
+  for (int i = 0; i < 6; ++i)
+  {
+    const double max_vel = limits_.velocity[i];
+    const double max_acc = limits_.acceleration[i];
+    const double max_jerk = limits_.jerk[i];
+
+    const double goal = clamp(target[i], max_vel);
+    const double error = goal - twist_[i];
+
+    if (max_jerk > 0.0)
+    {
+      // Head for the acceleration from which ramping down to zero just
+      // reaches the goal. The acceleration only ever moves by one
+      // jerk-limited step, so targets that change mid-ramp are followed
+      // within the jerk limit, at the price of an overshoot.
+      const double step = max_jerk * period;
+      accel_[i] += clamp(clamp(brakingAccel(error, step, period), max_acc) - accel_[i], step);
+    }
+    else
+    {
+      accel_[i] = clamp(error / period, max_acc);
+    }
+
+    const double vel = twist_[i] + accel_[i] * period;
+    const double limited = clamp(vel, max_vel);
+    if (limited != vel)
+    {
+      // Only what the velocity limit lets through
+      accel_[i] = (limited - twist_[i]) / period;
+    }
+    twist_[i] = limited;
+  }
+  return twist_;
+}
+
+}  // namespace cartesian_ros_control
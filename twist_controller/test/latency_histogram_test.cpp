@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <twist_controller/latency_histogram.h>
+
+using namespace cartesian_ros_control;
+
+TEST(LatencyHistogramTest, TestRecordIntoBuckets)
+{
+  LatencyHistogram histogram;
+  histogram.reset(3, 100);
+  ASSERT_EQ(4u, histogram.size());
+
+  histogram.record(0);
+  histogram.record(99);
+  histogram.record(150);
+  histogram.record(299);
+  histogram.record(300);    // Overflow
+  histogram.record(10000);  // Overflow
+
+  std::vector<uint64_t> data;
+  histogram.read(data);
+  std::vector<uint64_t> expected = { 6, 0, 10000, 10848, 2, 1, 1, 2 };
+  EXPECT_EQ(expected, data);
+}
+
+TEST(LatencyHistogramTest, TestClear)
+{
+  LatencyHistogram histogram;
+  histogram.reset(2, 10);
+  histogram.record(5);
+  histogram.clear();
+
+  std::vector<uint64_t> data;
+  histogram.read(data);
+  std::vector<uint64_t> expected = { 0, 0, 0, 0, 0, 0, 0 };
+  EXPECT_EQ(expected, data);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
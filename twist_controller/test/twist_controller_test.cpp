@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <unistd.h>
+
+#include <twist_controller/twist_controller.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+const ros::Duration period(0.002);
+
+/**
+ * @brief A TwistController on its own buffers, without limits, timeout or ROS node
+ */
+class TwistControllerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    pose.orientation.w = 1.0;
+    controller.handle_ = TwistCommandHandle(CartesianStateHandle("base", "tool0", &pose, &twist, &accel, &jerk),
+                                            &command);
+    TwistController::TwistGain gain;
+    gain.values.setOnes();
+    controller.gain_buffer_.initRT(gain);
+    controller.setCommandTimeout(ros::Duration(0.0));
+    time = ros::Time::now();
+  }
+
+  TwistController::TwistCommand makeCommand(int axis, double value) const
+  {
+    TwistController::TwistCommand cmd;
+    cmd.twist[axis] = value;
+    cmd.stamp = time;
+    cmd.received = time;
+    return cmd;
+  }
+
+  void update()
+  {
+    time += period;
+    controller.update(time, period);
+  }
+
+  geometry_msgs::Pose pose;
+  geometry_msgs::Twist twist;
+  geometry_msgs::Accel accel;
+  geometry_msgs::Accel jerk;
+  geometry_msgs::Twist command;
+  TwistController controller;
+  ros::Time time;
+};
+}  // namespace
+
+TEST_F(TwistControllerTest, TestSetCommand)
+{
+  for (const size_t queue_size : { 0, 8 })
+  {
+    time = ros::Time::now();
+    controller.setQueueSize(queue_size);
+    controller.starting(time);
+
+    // Commands without stamps would time out right away
+    controller.setCommandTimeout(ros::Duration(0.5));
+    TwistController::TwistCommand cmd;
+    cmd.twist << 0.1, 0.2, 0.3, 0.0, 0.0, 0.0;
+    controller.setCommand(cmd);
+    update();
+    EXPECT_DOUBLE_EQ(0.1, command.linear.x) << "queue_size " << queue_size;
+    EXPECT_DOUBLE_EQ(0.2, command.linear.y) << "queue_size " << queue_size;
+    EXPECT_DOUBLE_EQ(0.3, command.linear.z) << "queue_size " << queue_size;
+
+    Vector6d twist;
+    twist << 0.0, 0.0, 0.0, 0.4, 0.5, 0.6;
+    controller.setCommand(twist);
+    update();
+    EXPECT_DOUBLE_EQ(0.0, command.linear.x) << "queue_size " << queue_size;
+    EXPECT_DOUBLE_EQ(0.4, command.angular.x) << "queue_size " << queue_size;
+    EXPECT_DOUBLE_EQ(0.5, command.angular.y) << "queue_size " << queue_size;
+    EXPECT_DOUBLE_EQ(0.6, command.angular.z) << "queue_size " << queue_size;
+
+    // The stamp from setCommand() drives the timeout
+    time += ros::Duration(1.0);
+    update();
+    EXPECT_DOUBLE_EQ(0.0, command.angular.z) << "queue_size " << queue_size;
+  }
+}
+
+TEST_F(TwistControllerTest, TestQueuedCommandsAfterSharedMemory)
+{
+  const std::string name = "/twist_controller_test_" + std::to_string(getpid());
+  std::string error;
+  controller.setQueueSize(8);
+  ASSERT_TRUE(controller.openSharedMemory(name, error)) << error;
+  SharedMemorySlot<SharedTwistCommand> writer;
+  ASSERT_TRUE(writer.open(name, false, error)) << error;
+  controller.starting(time);
+
+  SharedTwistCommand sample = {};
+  sample.twist[0] = 0.5;
+  sample.stamp = time.toNSec();
+  writer.write(sample);
+  update();
+  EXPECT_DOUBLE_EQ(0.5, command.linear.x);
+
+  // Queued commands take over again once they are newer
+  controller.setCommand(makeCommand(1, 0.3));
+  update();
+  EXPECT_DOUBLE_EQ(0.0, command.linear.x);
+  EXPECT_DOUBLE_EQ(0.3, command.linear.y);
+
+  // Nothing new on either side keeps the last source
+  update();
+  EXPECT_DOUBLE_EQ(0.3, command.linear.y);
+
+  sample.twist[0] = -0.5;
+  writer.write(sample);
+  update();
+  EXPECT_DOUBLE_EQ(-0.5, command.linear.x);
+  EXPECT_DOUBLE_EQ(0.0, command.linear.y);
+}
+
+TEST_F(TwistControllerTest, TestFutureSharedMemoryStampsTimeOut)
+{
+  const std::string name = "/twist_controller_test_" + std::to_string(getpid());
+  std::string error;
+  ASSERT_TRUE(controller.openSharedMemory(name, error)) << error;
+  SharedMemorySlot<SharedTwistCommand> writer;
+  ASSERT_TRUE(writer.open(name, false, error)) << error;
+  controller.setCommandTimeout(ros::Duration(0.5));
+  controller.starting(time);
+
+  SharedTwistCommand sample = {};
+  sample.twist[0] = 0.5;
+  sample.stamp = (time + ros::Duration(3600.0)).toNSec();
+  writer.write(sample);
+  update();
+  EXPECT_DOUBLE_EQ(0.5, command.linear.x);
+
+  // The producer went silent
+  time += ros::Duration(1.0);
+  update();
+  EXPECT_DOUBLE_EQ(0.0, command.linear.x);
+}
+
+TEST_F(TwistControllerTest, TestFutureStampsDontBlockTheQueue)
+{
+  controller.setQueueSize(8);
+  controller.starting(time);
+
+  TwistController::TwistCommand cmd = makeCommand(0, 0.2);
+  cmd.stamp = time + ros::Duration(60.0);
+  controller.setCommand(cmd);
+  controller.setCommand(makeCommand(0, 0.4));
+  update();
+  EXPECT_NEAR(0.3, command.linear.x, 1e-12);
+}
+
+int main(int argc, char** argv)
+{
+  ros::Time::init();
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2020 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Scherzinger scherzin@fzi.de
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <twist_controller/twist_limiter.h>
+
+using namespace cartesian_ros_control;
+
+namespace
+{
+const double period = 0.002;
+}
+
+TEST(TwistLimiterTest, TestUnlimitedFollowsTarget)
+{
+  TwistLimiter limiter;
+  Vector6d target;
+  target << 0.1, -0.2, 0.3, -0.4, 0.5, -0.6;
+
+  EXPECT_TRUE(limiter.update(target, period).isApprox(target));
+}
+
+TEST(TwistLimiterTest, TestVelocityLimit)
+{
+  TwistLimits limits;
+  limits.velocity.setConstant(0.25);
+  TwistLimiter limiter;
+  limiter.setLimits(limits);
+
+  Vector6d target;
+  target << 1.0, -1.0, 0.1, 0.0, 2.0, -0.25;
+  Vector6d expected;
+  expected << 0.25, -0.25, 0.1, 0.0, 0.25, -0.25;
+
+  EXPECT_TRUE(limiter.update(target, period).isApprox(expected));
+}
+
+TEST(TwistLimiterTest, TestStepStaysWithinLimits)
+{
+  TwistLimits limits;
+  limits.velocity.setConstant(1.0);
+  limits.acceleration.setConstant(2.0);
+  limits.jerk.setConstant(20.0);
+  TwistLimiter limiter;
+  limiter.setLimits(limits);
+
+  Vector6d target = Vector6d::Zero();
+  target[0] = 0.5;
+  target[4] = -1.0;
+
+  Vector6d last_accel = Vector6d::Zero();
+  for (int i = 0; i < 2000; ++i)
+  {
+    // A stop command halfway through
+    if (i == 500)
+    {
+      target.setZero();
+    }
+    limiter.update(target, period);
+
+    const Vector6d jerk = (limiter.getAccel() - last_accel) / period;
+    last_accel = limiter.getAccel();
+    for (int j = 0; j < 6; ++j)
+    {
+      ASSERT_LE(std::abs(limiter.getTwist()[j]), 1.0 + 1e-9);
+      ASSERT_LE(std::abs(limiter.getAccel()[j]), 2.0 + 1e-9);
+      ASSERT_LE(std::abs(jerk[j]), 20.0 + 1e-6) << "Axis " << j << " in cycle " << i;
+    }
+  }
+
+  EXPECT_NEAR(0.0, limiter.getTwist().norm(), 1e-9);
+  EXPECT_NEAR(0.0, limiter.getAccel().norm(), 1e-9);
+}
+
+TEST(TwistLimiterTest, TestNoisyTargetStaysWithinLimits)
+{
+  TwistLimits limits;
+  limits.velocity.setConstant(1.0);
+  limits.acceleration.setConstant(2.0);
+  limits.jerk.setConstant(10.0);
+
+  // Bursts of noisy commands that change the target mid-ramp
+  for (double dt : { 0.001, 0.004, 0.01 })
+  {
+    TwistLimiter limiter;
+    limiter.setLimits(limits);
+    std::mt19937 generator(42);
+    std::normal_distribution<double> noise(0.5, 0.5);
+
+    Vector6d target = Vector6d::Zero();
+    Vector6d last_accel = Vector6d::Zero();
+    for (int i = 0; i < 20000; ++i)
+    {
+      if (i % 7 == 0)
+      {
+        for (int j = 0; j < 6; ++j)
+        {
+          target[j] = noise(generator);
+        }
+      }
+      limiter.update(target, dt);
+
+      const Vector6d jerk = (limiter.getAccel() - last_accel) / dt;
+      last_accel = limiter.getAccel();
+      for (int j = 0; j < 6; ++j)
+      {
+        ASSERT_LE(std::abs(limiter.getTwist()[j]), 1.0 + 1e-9);
+        ASSERT_LE(std::abs(limiter.getAccel()[j]), 2.0 + 1e-9);
+        ASSERT_LE(std::abs(jerk[j]), 10.0 + 1e-6) << "Axis " << j << " in cycle " << i << " at " << dt << " s";
+      }
+    }
+  }
+}
+
+TEST(TwistLimiterTest, TestReachesTarget)
+{
+  TwistLimits limits;
+  limits.acceleration.setConstant(1.0);
+  limits.jerk.setConstant(10.0);
+  TwistLimiter limiter;
+  limiter.setLimits(limits);
+
+  Vector6d target = Vector6d::Constant(0.3);
+  for (int i = 0; i < 1000; ++i)
+  {
+    limiter.update(target, period);
+  }
+
+  EXPECT_TRUE(limiter.getTwist().isApprox(target));
+  EXPECT_NEAR(0.0, limiter.getAccel().norm(), 1e-9);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}